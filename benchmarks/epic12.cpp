@@ -0,0 +1,80 @@
+#include "benchmark/benchmark_api.h"
+#include "emucore.h"
+#include "video/epic12span.h"
+
+#include <vector>
+
+// one 320 pixel row of a Cave sprite layer: mostly opaque with transparent edges
+static constexpr int ROW_WIDTH = 320;
+
+struct epic12_row
+{
+	epic12_row() : src(ROW_WIDTH), dest(ROW_WIDTH)
+	{
+		for (int i = 0; i < ROW_WIDTH; i++)
+		{
+			u32 const rgb = (u32(i * 0x2f1) ^ u32(i * 0x10307)) & 0x00f8f8f8;
+			src[i] = rgb | (((i % 64) < 56) ? epic12span::PEN_TRANSPARENT : 0);
+			dest[i] = (rgb * 3) & 0x00f8f8f8;
+		}
+	}
+
+	std::vector<u32> src, dest;
+	epic12span::blit_params const params = { 0x1f, 0x10, 0x20, 0x18, 0x28 };
+};
+
+static void BM_epic12_copy_generic(benchmark::State& state) {
+	epic12_row row;
+	while (state.KeepRunning())
+		epic12span::copy_row_generic<true, false>(&row.dest[0], &row.src[0], ROW_WIDTH);
+}
+static void BM_epic12_copy(benchmark::State& state) {
+	epic12_row row;
+	while (state.KeepRunning())
+		epic12span::copy_row<true, false>(&row.dest[0], &row.src[0], ROW_WIDTH);
+}
+
+static void BM_epic12_tint_generic(benchmark::State& state) {
+	epic12_row row;
+	while (state.KeepRunning())
+		epic12span::blend_row_generic<-1, 0, true, true, false>(&row.dest[0], &row.src[0], ROW_WIDTH, row.params);
+}
+static void BM_epic12_tint(benchmark::State& state) {
+	epic12_row row;
+	while (state.KeepRunning())
+		epic12span::blend_row<-1, 0, true, true, false>(&row.dest[0], &row.src[0], ROW_WIDTH, row.params);
+}
+
+// source alpha + destination alpha, the most common in-game mode
+static void BM_epic12_s0_d0_generic(benchmark::State& state) {
+	epic12_row row;
+	while (state.KeepRunning())
+		epic12span::blend_row_generic<0, 0, false, true, false>(&row.dest[0], &row.src[0], ROW_WIDTH, row.params);
+}
+static void BM_epic12_s0_d0(benchmark::State& state) {
+	epic12_row row;
+	while (state.KeepRunning())
+		epic12span::blend_row<0, 0, false, true, false>(&row.dest[0], &row.src[0], ROW_WIDTH, row.params);
+}
+
+// tinted, flipped, source alpha + inverse source times destination
+static void BM_epic12_s0_d5_tint_flip_generic(benchmark::State& state) {
+	epic12_row row;
+	while (state.KeepRunning())
+		epic12span::blend_row_generic<0, 5, true, true, true>(&row.dest[0], &row.src[ROW_WIDTH - 1], ROW_WIDTH, row.params);
+}
+static void BM_epic12_s0_d5_tint_flip(benchmark::State& state) {
+	epic12_row row;
+	while (state.KeepRunning())
+		epic12span::blend_row<0, 5, true, true, true>(&row.dest[0], &row.src[ROW_WIDTH - 1], ROW_WIDTH, row.params);
+}
+
+// Register the function as a benchmark
+BENCHMARK(BM_epic12_copy_generic);
+BENCHMARK(BM_epic12_copy);
+BENCHMARK(BM_epic12_tint_generic);
+BENCHMARK(BM_epic12_tint);
+BENCHMARK(BM_epic12_s0_d0_generic);
+BENCHMARK(BM_epic12_s0_d0);
+BENCHMARK(BM_epic12_s0_d5_tint_flip_generic);
+BENCHMARK(BM_epic12_s0_d5_tint_flip);
@@ -49,7 +49,10 @@ drc_cache::drc_cache(size_t bytes) :
 	m_codegen(nullptr),
 	m_size(m_cache.size()),
 	m_executable(false),
-	m_rwx(false)
+	m_rwx(false),
+	m_codegen_blocks(0),
+	m_codegen_bytes(0),
+	m_flush_count(0)
 {
 	// alignment and page size must be powers of two, cache must be page-aligned
 	assert(!(CACHE_ALIGNMENT & (CACHE_ALIGNMENT - 1)));
@@ -102,6 +105,7 @@ void drc_cache::flush()
 
 	// just reset the top back to the base and re-seed
 	m_top = m_base;
+	m_flush_count++;
 	codegen_init();
 }
 
@@ -277,8 +281,10 @@ drccodeptr drc_cache::end_codegen()
 		m_oob_free.splice(m_oob_free.begin(), m_oob_list, m_oob_list.begin());
 	}
 
-	// update the cache top
+	// update the cache top and statistics
 	osd::invalidate_instruction_cache(m_codegen, m_top - m_codegen);
+	m_codegen_blocks++;
+	m_codegen_bytes += m_top - m_codegen;
 	m_top = ALIGN_PTR_UP(m_top, CACHE_ALIGNMENT);
 	m_codegen = nullptr;
 
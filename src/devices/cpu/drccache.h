@@ -55,6 +55,12 @@ public:
 	bool contains_near_pointer(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_neartop); }
 	bool generating_code() const { return (m_codegen != nullptr); }
 
+	// statistics
+	uint64_t codegen_blocks() const { return m_codegen_blocks; }
+	uint64_t codegen_bytes() const { return m_codegen_bytes; }
+	uint32_t flush_count() const { return m_flush_count; }
+	size_t code_bytes_used() const { return m_top - m_base; }
+
 	// memory management
 	void flush();
 	void *alloc(size_t bytes);
@@ -96,6 +102,11 @@ private:
 	bool                m_executable;       // whether cached code is currently executable
 	bool                m_rwx;              // whether pages can be simultaneously writable and executable
 
+	// statistics
+	uint64_t            m_codegen_blocks;   // number of code blocks generated
+	uint64_t            m_codegen_bytes;    // total bytes of code generated
+	uint32_t            m_flush_count;      // number of times the cache has been flushed
+
 	// oob management
 	struct oob_handler
 	{
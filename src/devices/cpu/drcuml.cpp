@@ -41,7 +41,9 @@
 #include "drcbex64.h"
 #endif
 
+#include <algorithm>
 #include <fstream>
+#include <sstream>
 
 
 
@@ -148,7 +150,26 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 	, m_blocklist()
 	, m_handlelist()
 	, m_symlist()
+	, m_blocks_compiled(0)
+	, m_blocks_recompiled(0)
+	, m_flushes_full(0)
+	, m_flushes_requested(0)
+	, m_abort_pending(false)
+	, m_entrycounts(nullptr)
+	, m_entryslots()
+	, m_hotblocks()
 {
+	// when logging, reserve counters in the near cache so generated code can count block entries
+	if (logging())
+	{
+		m_entrycounts = reinterpret_cast<u32 *>(cache.alloc_near(sizeof(*m_entrycounts) * ENTRY_COUNTER_SLOTS));
+		if (m_entrycounts)
+		{
+			std::fill_n(m_entrycounts, ENTRY_COUNTER_SLOTS, 0);
+			symbol_add(m_entrycounts, sizeof(*m_entrycounts) * ENTRY_COUNTER_SLOTS, "entry_counts");
+			m_entryslots.reserve(ENTRY_COUNTER_SLOTS);
+		}
+	}
 }
 
 
@@ -158,6 +179,12 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 
 drcuml_state::~drcuml_state()
 {
+	// dump statistics and the hot block report to the log
+	if (logging())
+	{
+		gather_entry_counts();
+		log_statistics();
+	}
 }
 
 
@@ -168,6 +195,21 @@ drcuml_state::~drcuml_state()
 
 void drcuml_state::reset()
 {
+	// account for the flush, ignoring the initial one before any code exists
+	if (m_cache.codegen_blocks() != 0)
+	{
+		if (m_abort_pending)
+			m_flushes_full++;
+		else
+			m_flushes_requested++;
+		if (logging())
+			log_printf("; cache flush (%s) with %u bytes of code in use\n\n", m_abort_pending ? "out of space" : "requested", u32(m_cache.code_bytes_used()));
+	}
+	m_abort_pending = false;
+
+	// collect entry counts before the code using them goes away
+	gather_entry_counts();
+
 	// if we error here, we are screwed
 	try
 	{
@@ -275,6 +317,86 @@ const char *drcuml_state::symbol_find(void *base, u32 *offset)
 }
 
 
+//-------------------------------------------------
+//  alloc_entry_counter - assign an entry counter
+//  to a hash entry point, returning nullptr if
+//  not logging or if all counters are in use
+//-------------------------------------------------
+
+u32 *drcuml_state::alloc_entry_counter(u32 mode, u32 pc)
+{
+	// once the counters run out, entry points go unsampled until the next flush
+	if (!m_entrycounts || (m_entryslots.size() >= ENTRY_COUNTER_SLOTS))
+		return nullptr;
+
+	m_entryslots.push_back(entry_slot{ mode, pc, nullptr });
+	return &m_entrycounts[m_entryslots.size() - 1];
+}
+
+
+//-------------------------------------------------
+//  gather_entry_counts - accumulate the entry
+//  counters and release them for reuse
+//-------------------------------------------------
+
+void drcuml_state::gather_entry_counts()
+{
+	for (u32 slot = 0; slot < m_entryslots.size(); slot++)
+	{
+		entry_slot &entry(m_entryslots[slot]);
+		hot_block &block(m_hotblocks[(u64(entry.mode) << 32) | entry.pc]);
+		block.count += m_entrycounts[slot];
+		if (entry.disasm)
+			block.disasm = std::move(entry.disasm);
+		m_entrycounts[slot] = 0;
+	}
+	m_entryslots.clear();
+}
+
+
+//-------------------------------------------------
+//  log_statistics - write compilation statistics
+//  and the most frequently entered blocks to the
+//  UML log
+//-------------------------------------------------
+
+void drcuml_state::log_statistics()
+{
+	log_printf("; DRC statistics for %s\n", m_device.tag());
+	log_printf(";   guest blocks compiled:   %u\n", m_blocks_compiled);
+	log_printf(";   guest blocks recompiled: %u\n", m_blocks_recompiled);
+	log_printf(";   code blocks generated:   %u\n", m_cache.codegen_blocks());
+	log_printf(";   code bytes generated:    %u\n", m_cache.codegen_bytes());
+	log_printf(";   cache flushes:           %u requested, %u out of space\n", m_flushes_requested, m_flushes_full);
+
+	// find the most frequently entered blocks
+	std::vector<std::pair<u64, hot_block const *> > sorted;
+	sorted.reserve(m_hotblocks.size());
+	for (auto const &block : m_hotblocks)
+		if (block.second.count != 0)
+			sorted.emplace_back(block.first, &block.second);
+	auto const last(sorted.begin() + std::min<size_t>(sorted.size(), HOT_BLOCK_REPORT_SIZE));
+	std::partial_sort(
+			sorted.begin(),
+			last,
+			sorted.end(),
+			[] (auto const &a, auto const &b) { return a.second->count > b.second->count; });
+
+	log_printf("\n; hot blocks\n");
+	for (auto it = sorted.begin(); it != last; ++it)
+		log_printf(";   (%X,%08X): %u entries\n", u32(it->first >> 32), u32(it->first), it->second->count);
+	for (auto it = sorted.begin(); it != last; ++it)
+	{
+		if (it->second->disasm)
+		{
+			log_printf("\n; (%X,%08X): %u entries\n", u32(it->first >> 32), u32(it->first), it->second->count);
+			log_printf("%s", *it->second->disasm);
+		}
+	}
+	log_flush();
+}
+
+
 //-------------------------------------------------
 //  log_vprintf - directly printf to the UML log
 //  if generated
@@ -340,12 +462,24 @@ void drcuml_block::end()
 {
 	assert(m_inuse);
 
+	// account for guest code and instrument entry points when logging
+	size_t const firstslot(m_drcuml.m_entryslots.size());
+	count_entries();
+
 	// optimize the resulting code first
 	optimize();
 
 	// if we have a logfile, generate a disassembly of the block
 	if (m_drcuml.logging())
-		disassemble();
+	{
+		auto const disasm(std::make_shared<std::string const>(disassemble()));
+		m_drcuml.log_printf("%s", *disasm);
+		m_drcuml.log_flush();
+
+		// keep it for the hot block report
+		for (size_t slot = firstslot; slot < m_drcuml.m_entryslots.size(); slot++)
+			m_drcuml.m_entryslots[slot].disasm = disasm;
+	}
 
 	// generate the code via the back-end
 	m_drcuml.cache().codegen_init();
@@ -367,6 +501,9 @@ void drcuml_block::abort()
 	// block is no longer in use
 	m_inuse = false;
 
+	// let the next flush know why it happened
+	m_drcuml.m_abort_pending = true;
+
 	// unwind
 	throw abort_compilation();
 }
@@ -434,13 +571,65 @@ void drcuml_block::optimize()
 }
 
 
+//-------------------------------------------------
+//  count_entries - update compilation statistics
+//  from the hash entries in the block, and add
+//  entry counters after them when logging
+//-------------------------------------------------
+
+void drcuml_block::count_entries()
+{
+	// the first hash entry tells us whether this is new code or a recompile
+	u32 hashes(0);
+	for (u32 instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction const &inst(m_inst[instnum]);
+		if (inst.opcode() == uml::OP_HASH)
+		{
+			if (hashes++ == 0)
+			{
+				if (m_drcuml.hash_exists(inst.param(0).immediate(), inst.param(1).immediate()))
+					m_drcuml.m_blocks_recompiled++;
+				else
+					m_drcuml.m_blocks_compiled++;
+			}
+		}
+	}
+
+	// nothing more to do unless we have counters
+	if (!hashes || !m_drcuml.m_entrycounts)
+		return;
+
+	// increment a counter on entry at each hash
+	std::vector<uml::instruction> instrumented;
+	instrumented.reserve(m_nextinst + hashes);
+	for (u32 instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction const &inst(m_inst[instnum]);
+		instrumented.push_back(inst);
+		if (inst.opcode() == uml::OP_HASH)
+		{
+			u32 *const counter(m_drcuml.alloc_entry_counter(inst.param(0).immediate(), inst.param(1).immediate()));
+			if (counter)
+				instrumented.emplace_back().add(uml::mem(counter), uml::mem(counter), 1);
+		}
+	}
+
+	if (instrumented.size() > m_inst.size())
+		m_inst.resize(instrumented.size());
+	std::copy(instrumented.begin(), instrumented.end(), m_inst.begin());
+	m_nextinst = instrumented.size();
+}
+
+
 //-------------------------------------------------
 //  disassemble - disassemble a block of
-//  instructions to the log
+//  instructions for the log
 //-------------------------------------------------
 
-void drcuml_block::disassemble()
+std::string drcuml_block::disassemble()
 {
+	std::ostringstream out;
 	std::string comment;
 
 	// iterate over instructions and output
@@ -459,11 +648,11 @@ void drcuml_block::disassemble()
 
 		// print labels, handles, and hashes left justified
 		else if (inst.opcode() == uml::OP_LABEL)
-			m_drcuml.log_printf("$%X:\n", u32(inst.param(0).label()));
+			util::stream_format(out, "$%X:\n", u32(inst.param(0).label()));
 		else if (inst.opcode() == uml::OP_HANDLE)
-			m_drcuml.log_printf("%s:\n", inst.param(0).handle().string());
+			util::stream_format(out, "%s:\n", inst.param(0).handle().string());
 		else if (inst.opcode() == uml::OP_HASH)
-			m_drcuml.log_printf("(%X,%X):\n", u32(inst.param(0).immediate()), u32(inst.param(1).immediate()));
+			util::stream_format(out, "(%X,%X):\n", u32(inst.param(0).immediate()), u32(inst.param(1).immediate()));
 
 		// indent everything else with a tab
 		else
@@ -473,13 +662,13 @@ void drcuml_block::disassemble()
 			// include the first accumulated comment with this line
 			if (firstcomment != -1)
 			{
-				m_drcuml.log_printf("\t%-50.50s; %s\n", dasm, get_comment_text(m_inst[firstcomment], comment));
+				util::stream_format(out, "\t%-50.50s; %s\n", dasm, get_comment_text(m_inst[firstcomment], comment));
 				firstcomment++;
 				flushcomments = true;
 			}
 			else
 			{
-				m_drcuml.log_printf("\t%s\n", dasm);
+				util::stream_format(out, "\t%s\n", dasm);
 			}
 		}
 
@@ -490,13 +679,13 @@ void drcuml_block::disassemble()
 			{
 				char const *const text(get_comment_text(m_inst[firstcomment++], comment));
 				if (text)
-					m_drcuml.log_printf("\t%50s; %s\n", "", text);
+					util::stream_format(out, "\t%50s; %s\n", "", text);
 			}
 			firstcomment = -1;
 		}
 	}
-	m_drcuml.log_printf("\n\n");
-	m_drcuml.log_flush();
+	util::stream_format(out, "\n\n");
+	return out.str();
 }
 
 
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 
@@ -113,7 +114,8 @@ public:
 private:
 	// internal helpers
 	void optimize();
-	void disassemble();
+	void count_entries();
+	std::string disassemble();
 	char const *get_comment_text(uml::instruction const &inst, std::string &comment);
 
 	// internal state
@@ -157,6 +159,8 @@ protected:
 // structure describing UML generation state
 class drcuml_state
 {
+	friend class drcuml_block;
+
 public:
 	// construction/destruction
 	drcuml_state(device_t &device, drc_cache &cache, u32 flags, int modes, int addrbits, int ignorebits);
@@ -196,7 +200,39 @@ public:
 	void log_flush() { if (logging()) m_umllog->flush(); }
 	bool logging_native() const { return m_beintf->logging(); }
 
+	// statistics
+	u64 blocks_compiled() const { return m_blocks_compiled; }
+	u64 blocks_recompiled() const { return m_blocks_recompiled; }
+	u32 flushes_cache_full() const { return m_flushes_full; }
+	u32 flushes_requested() const { return m_flushes_requested; }
+
 private:
+	// number of entry points that can be instrumented between cache flushes
+	static constexpr u32 ENTRY_COUNTER_SLOTS = 1024;
+
+	// number of entry points listed in the hot block report
+	static constexpr u32 HOT_BLOCK_REPORT_SIZE = 20;
+
+	// an instrumented entry point
+	struct entry_slot
+	{
+		u32                                 mode;       // mode of the entry point
+		u32                                 pc;         // PC of the entry point
+		std::shared_ptr<std::string const>  disasm;     // UML disassembly of the containing block
+	};
+
+	// accumulated execution counts for an entry point
+	struct hot_block
+	{
+		u64                                 count;      // total number of entries
+		std::shared_ptr<std::string const>  disasm;     // most recent UML disassembly
+	};
+
+	// statistics helpers
+	u32 *alloc_entry_counter(u32 mode, u32 pc);
+	void gather_entry_counts();
+	void log_statistics();
+
 	// symbol class
 	class symbol
 	{
@@ -228,6 +264,16 @@ private:
 	std::list<drcuml_block>                 m_blocklist;        // list of active blocks
 	std::list<uml::code_handle>             m_handlelist;       // list of active handles
 	std::list<symbol>                       m_symlist;          // list of symbols
+
+	// statistics
+	u64                                     m_blocks_compiled;  // guest blocks compiled for a missing hash entry
+	u64                                     m_blocks_recompiled;// guest blocks recompiled over an existing hash entry
+	u32                                     m_flushes_full;     // cache flushes after running out of space
+	u32                                     m_flushes_requested;// cache flushes requested by the CPU core
+	bool                                    m_abort_pending;    // a block was aborted since the last flush
+	u32 *                                   m_entrycounts;      // entry counters (in near cache) when logging
+	std::vector<entry_slot>                 m_entryslots;       // entry points using the counters
+	std::unordered_map<u64, hot_block>      m_hotblocks;        // counts gathered across cache flushes
 };
 
 
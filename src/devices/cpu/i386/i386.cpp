@@ -308,6 +308,26 @@ bool i386_device::translate_address(int pl, int type, uint32_t *address, uint32_
 	return true;
 }
 
+// Instruction fetches nearly always stay on the page of the previous fetch,
+// so remember the last code page translation and skip the TLB walk while the
+// privilege level and paging state it was made under still hold.  The tag is
+// dropped whenever the TLB is flushed.
+bool i386_device::translate_fetch(uint32_t *address, uint32_t *error)
+{
+	const uint32_t tag = (*address & 0xfffff000) | m_CPL | ((m_cr[0] >> 29) & 4);
+	if (tag == m_fetch_page_tag)
+	{
+		*address = m_fetch_page_phys | (*address & 0xfff);
+		return true;
+	}
+
+	if (!translate_address(m_CPL, TR_FETCH, address, error))
+		return false;
+	m_fetch_page_tag = tag;
+	m_fetch_page_phys = *address & 0xfffff000;
+	return true;
+}
+
 /***********************************************************************************/
 
 void i386_device::CHANGE_PC(uint32_t pc)
@@ -327,7 +347,7 @@ uint8_t i386_device::FETCH()
 	uint8_t value;
 	uint32_t address = m_pc, error;
 
-	if(!translate_address(m_CPL,TR_FETCH,&address,&error))
+	if(!translate_fetch(&address,&error))
 		PF_THROW(error);
 
 	value = mem_pr8(address & m_a20_mask);
@@ -348,7 +368,7 @@ uint16_t i386_device::FETCH16()
 		value = (FETCH() << 0);
 		value |= (FETCH() << 8);
 	} else {
-		if(!translate_address(m_CPL,TR_FETCH,&address,&error))
+		if(!translate_fetch(&address,&error))
 			PF_THROW(error);
 		address &= m_a20_mask;
 		value = mem_pr16(address);
@@ -368,7 +388,7 @@ uint32_t i386_device::FETCH32()
 		value |= (FETCH() << 16);
 		value |= (FETCH() << 24);
 	} else {
-		if(!translate_address(m_CPL,TR_FETCH,&address,&error))
+		if(!translate_fetch(&address,&error))
 			PF_THROW(error);
 
 		address &= m_a20_mask;
@@ -1905,6 +1925,7 @@ void i386_device::i386_postload()
 	for (i = 0; i < 6; i++)
 		i386_load_segment_descriptor(i);
 	CHANGE_PC(m_eip);
+	fetch_page_flush();
 }
 
 void i386_device::i386_common_init()
@@ -2449,6 +2470,8 @@ void i386_device::zero_state()
 	m_opcode = 0;
 	m_irq_state = 0;
 	m_a20_mask = 0;
+	m_fetch_page_tag = ~0U;
+	m_fetch_page_phys = 0;
 	m_cpuid_max_input_value_eax = 0;
 	m_cpuid_id0 = 0;
 	m_cpuid_id1 = 0;
@@ -2757,6 +2780,7 @@ void i386_device::i386_set_a20_line(int state)
 	}
 	// TODO: how does A20M and the tlb interact
 	vtlb_flush_dynamic();
+	fetch_page_flush();
 }
 
 void i386_device::execute_run()
@@ -308,6 +308,8 @@ protected:
 	address_space *m_program;
 	address_space *m_io;
 	uint32_t m_a20_mask;
+	uint32_t m_fetch_page_tag;  // linear page | CPL | paging enabled << 2 of the last code page translated
+	uint32_t m_fetch_page_phys; // physical page it translated to
 	memory_access<32, 1, 0, ENDIANNESS_LITTLE>::cache macache16;
 	memory_access<32, 2, 0, ENDIANNESS_LITTLE>::cache macache32;
 
@@ -399,6 +401,8 @@ protected:
 	inline vtlb_entry get_permissions(uint32_t pte, int wp);
 	bool i386_translate_address(int intention, bool debug, offs_t *address, vtlb_entry *entry);
 	bool translate_address(int pl, int type, uint32_t *address, uint32_t *error);
+	bool translate_fetch(uint32_t *address, uint32_t *error);
+	void fetch_page_flush() { m_fetch_page_tag = ~0U; }
 	void CHANGE_PC(uint32_t pc);
 	inline void NEAR_BRANCH(int32_t offs);
 	inline uint8_t FETCH();
@@ -381,10 +381,33 @@ void psxcpu_device::cache_writeword( uint32_t offset, uint32_t data )
 	}
 }
 
+inline uint32_t *psxcpu_device::fastram_pointer( uint32_t address )
+{
+	// main ram is mirrored in kuseg, kseg0 and kseg1
+	uint32_t segment = address >> 29;
+	if( ( segment == 0 || segment == 4 || segment == 5 ) && ( address & 0x1fffffff ) < m_fastram_window )
+	{
+		return &m_fastram[ ( address & m_fastram_mask ) / 4 ];
+	}
+
+	if( m_fast_scratchpad && ( address & ~0x3ff ) == 0x1f800000 )
+	{
+		return &m_dcache[ ( address & 0x3ff ) / 4 ];
+	}
+
+	return nullptr;
+}
+
 uint8_t psxcpu_device::readbyte( uint32_t address )
 {
 	if( m_bus_attached )
 	{
+		uint32_t *fast = fastram_pointer( address );
+		if( fast != nullptr )
+		{
+			return *fast >> ( ( address & 3 ) * 8 );
+		}
+
 		return m_data.read_byte( address );
 	}
 
@@ -395,6 +418,12 @@ uint16_t psxcpu_device::readhalf( uint32_t address )
 {
 	if( m_bus_attached )
 	{
+		uint32_t *fast = fastram_pointer( address );
+		if( fast != nullptr )
+		{
+			return *fast >> ( ( address & 2 ) * 8 );
+		}
+
 		return m_data.read_word( address );
 	}
 
@@ -405,6 +434,12 @@ uint32_t psxcpu_device::readword( uint32_t address )
 {
 	if( m_bus_attached )
 	{
+		uint32_t *fast = fastram_pointer( address );
+		if( fast != nullptr )
+		{
+			return *fast;
+		}
+
 		return m_data.read_dword( address );
 	}
 
@@ -415,6 +450,12 @@ uint32_t psxcpu_device::readword_masked( uint32_t address, uint32_t mask )
 {
 	if( m_bus_attached )
 	{
+		uint32_t *fast = fastram_pointer( address );
+		if( fast != nullptr )
+		{
+			return *fast;
+		}
+
 		return m_data.read_dword( address, mask );
 	}
 
@@ -425,7 +466,15 @@ void psxcpu_device::writeword( uint32_t address, uint32_t data )
 {
 	if( m_bus_attached )
 	{
-		m_data.write_dword( address, data );
+		uint32_t *fast = fastram_pointer( address );
+		if( fast != nullptr )
+		{
+			*fast = data;
+		}
+		else
+		{
+			m_data.write_dword( address, data );
+		}
 	}
 	else
 	{
@@ -437,7 +486,15 @@ void psxcpu_device::writeword_masked( uint32_t address, uint32_t data, uint32_t
 {
 	if( m_bus_attached )
 	{
-		m_data.write_dword( address, data, mask );
+		uint32_t *fast = fastram_pointer( address );
+		if( fast != nullptr )
+		{
+			*fast = ( *fast & ~mask ) | ( data & mask );
+		}
+		else
+		{
+			m_data.write_dword( address, data, mask );
+		}
 	}
 	else
 	{
@@ -1348,6 +1405,9 @@ void psxcpu_device::update_scratchpad()
 	{
 		m_program->install_ram( 0x1f800000, 0x1f8003ff, m_dcache );
 	}
+
+	// memory accessed directly doesn't trigger debugger watchpoints
+	m_fast_scratchpad = ( m_biu & ( BIU_RAM | BIU_DS ) ) == ( BIU_RAM | BIU_DS ) && ( machine().debug_flags & DEBUG_FLAG_ENABLED ) == 0;
 }
 
 void psxcpu_device::update_ram_config()
@@ -1396,6 +1456,15 @@ void psxcpu_device::update_ram_config()
 		}
 	}
 
+	// loads and stores can go straight to ram when it is a power of two mirrored across the window
+	m_fastram = reinterpret_cast<uint32_t *>( pointer );
+	m_fastram_mask = ram_size - 1;
+	m_fastram_window = 0;
+	if( ram_size > 0 && ( ram_size & ( ram_size - 1 ) ) == 0 && ( machine().debug_flags & DEBUG_FLAG_ENABLED ) == 0 )
+	{
+		m_fastram_window = window_size;
+	}
+
 	m_program->install_readwrite_handler( 0x00000000 + window_size, 0x1effffff, read32smo_delegate(*this, FUNC(psxcpu_device::berr_r)), write32smo_delegate(*this, FUNC(psxcpu_device::berr_w)) );
 	m_program->install_readwrite_handler( 0x80000000 + window_size, 0x9effffff, read32smo_delegate(*this, FUNC(psxcpu_device::berr_r)), write32smo_delegate(*this, FUNC(psxcpu_device::berr_w)) );
 	m_program->install_readwrite_handler( 0xa0000000 + window_size, 0xbeffffff, read32smo_delegate(*this, FUNC(psxcpu_device::berr_r)), write32smo_delegate(*this, FUNC(psxcpu_device::berr_w)) );
@@ -1797,6 +1866,10 @@ psxcpu_device::psxcpu_device( const machine_config &mconfig, device_type type, c
 	m_rom( *this, "rom" )
 {
 	m_disable_rom_berr = false;
+	m_fastram = nullptr;
+	m_fastram_window = 0;
+	m_fastram_mask = 0;
+	m_fast_scratchpad = false;
 }
 
 cxd8530aq_device::cxd8530aq_device( const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock )
@@ -233,7 +233,14 @@ protected:
 	uint32_t m_ram_config;
 	uint32_t m_rom_config;
 
+	// direct access to main RAM and the scratchpad for loads and stores
+	uint32_t *m_fastram;
+	uint32_t m_fastram_window;
+	uint32_t m_fastram_mask;
+	bool m_fast_scratchpad;
+
 	void stop();
+	uint32_t *fastram_pointer( uint32_t address );
 	uint32_t cache_readword( uint32_t offset );
 	void cache_writeword( uint32_t offset, uint32_t data );
 	uint8_t readbyte( uint32_t address );
@@ -2347,6 +2347,7 @@ void sh_common_execution::code_compile_block(uint8_t mode, offs_t pc)
 
 	/* get a description of this sequence */
 	desclist = get_desclist(pc);
+	compiler.desclist = desclist;
 
 	if (m_drcuml->logging() || m_drcuml->logging_native())
 		log_opcode_desc(desclist, 0);
@@ -2639,6 +2640,63 @@ void sh_common_execution::generate_delay_slot(drcuml_block &block, compiler_stat
 	compiler.labelnum = compiler_temp.labelnum;
 }
 
+/*-------------------------------------------------
+    generate_access_cycles - account for cycles
+    after a memory access, unless cycles are only
+    checked at branches
+-------------------------------------------------*/
+
+void sh_common_execution::generate_access_cycles(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	/* pending interrupt checks still happen right away */
+	if (!(m_drcoptions & SH2DRC_BRANCH_CYCLES) || compiler.checkints)
+		generate_update_cycles(block, compiler, desc->pc + 2, true);
+}
+
+/*-------------------------------------------------
+    is_idle_loop - determine whether a short
+    backward branch closes a loop that can only
+    exit once something else changes memory
+-------------------------------------------------*/
+
+bool sh_common_execution::is_idle_loop(const compiler_state &compiler, const opcode_desc *branch) const
+{
+	if (!(m_drcoptions & SH2DRC_IDLE_LOOPS) || (branch->targetpc > branch->pc) || ((branch->pc - branch->targetpc) > IDLE_LOOP_MAX_BYTES))
+		return false;
+
+	/* find the top of the loop */
+	const opcode_desc *desc = compiler.desclist;
+	while (desc != nullptr && desc->pc != branch->targetpc)
+		desc = desc->next();
+
+	/* the loop body must not write memory or branch, and every register it reads must */
+	/* either be left alone by the loop or have been set earlier in the same iteration */
+	uint32_t written[4] = { 0 };
+	for (const opcode_desc *curdesc = desc; curdesc != branch; curdesc = curdesc->next())
+	{
+		if (curdesc == nullptr)
+			return false;
+		if (curdesc->flags & (OPFLAG_IS_BRANCH | OPFLAG_WRITES_MEMORY | OPFLAG_CAN_TRIGGER_SW_INT | OPFLAG_CAN_EXPOSE_EXTERNAL_INT | OPFLAG_CAN_CAUSE_EXCEPTION | OPFLAG_INVALID_OPCODE | OPFLAG_COMPILER_UNMAPPED))
+			return false;
+		for (int regnum = 0; regnum < 4; regnum++)
+			written[regnum] |= curdesc->regout[regnum];
+	}
+
+	uint32_t defined[4] = { 0 };
+	for (const opcode_desc *curdesc = desc; curdesc != branch; curdesc = curdesc->next())
+	{
+		for (int regnum = 0; regnum < 4; regnum++)
+		{
+			/* the T bit is always recomputed by the compare feeding the branch */
+			uint32_t const regin = curdesc->regin[regnum] & ((regnum == 1) ? ~REGFLAG_SR : ~0U);
+			if (regin & written[regnum] & ~defined[regnum])
+				return false;
+			defined[regnum] |= curdesc->regout[regnum];
+		}
+	}
+	return true;
+}
+
 void sh_common_execution::func_unimplemented()
 {
 	// set up an invalid opcode exception
@@ -2791,7 +2849,7 @@ bool sh_common_execution::generate_opcode(drcuml_block &block, compiler_state &c
 			UML_CALLH(block, *m_write32);
 
 			if (!in_delay_slot)
-				generate_update_cycles(block, compiler, desc->pc + 2, true);
+				generate_access_cycles(block, compiler, desc);
 			return true;
 
 		case  2:
@@ -2809,7 +2867,7 @@ bool sh_common_execution::generate_opcode(drcuml_block &block, compiler_state &c
 			UML_MOV(block, R32(Rn), I0);            // mov Rn, r0
 
 			if (!in_delay_slot)
-				generate_update_cycles(block, compiler, desc->pc + 2, true);
+				generate_access_cycles(block, compiler, desc);
 			return true;
 
 		case  6:
@@ -2848,7 +2906,7 @@ bool sh_common_execution::generate_opcode(drcuml_block &block, compiler_state &c
 			}
 
 			if (!in_delay_slot)
-				generate_update_cycles(block, compiler, desc->pc + 2, true);
+				generate_access_cycles(block, compiler, desc);
 			return true;
 
 		case 10:    // BRA
@@ -2901,7 +2959,7 @@ bool sh_common_execution::generate_opcode(drcuml_block &block, compiler_state &c
 			}
 
 			if (!in_delay_slot)
-				generate_update_cycles(block, compiler, desc->pc + 2, true);
+				generate_access_cycles(block, compiler, desc);
 			return true;
 
 		case 14:    // MOVI
@@ -2933,7 +2991,7 @@ bool sh_common_execution::generate_group_2(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write8);
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  1: // MOVWS(Rm, Rn);
@@ -2942,7 +3000,7 @@ bool sh_common_execution::generate_group_2(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write16);
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  2: // MOVLS(Rm, Rn);
@@ -2951,7 +3009,7 @@ bool sh_common_execution::generate_group_2(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write32);
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  3:
@@ -2964,7 +3022,7 @@ bool sh_common_execution::generate_group_2(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write8);         // call write8
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  5: // MOVWM(Rm, Rn);
@@ -2974,7 +3032,7 @@ bool sh_common_execution::generate_group_2(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write16);            // call write16
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  6: // MOVLM(Rm, Rn);
@@ -2984,7 +3042,7 @@ bool sh_common_execution::generate_group_2(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write32);            // call write32
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 13: // XTRCT(Rm, Rn);
@@ -3205,7 +3263,7 @@ bool sh_common_execution::generate_group_6(drcuml_block &block, compiler_state &
 		UML_SEXT(block, R32(Rn), I0, SIZE_BYTE);    // sext Rn, r0, BYTE
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  1: // MOVWL(Rm, Rn);
@@ -3215,7 +3273,7 @@ bool sh_common_execution::generate_group_6(drcuml_block &block, compiler_state &
 		UML_SEXT(block, R32(Rn), I0, SIZE_WORD);    // sext Rn, r0, WORD
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  2: // MOVLL(Rm, Rn);
@@ -3225,7 +3283,7 @@ bool sh_common_execution::generate_group_6(drcuml_block &block, compiler_state &
 		UML_MOV(block, R32(Rn), I0);        // mov Rn, r0
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  3: // MOV(Rm, Rn);
@@ -3269,7 +3327,7 @@ bool sh_common_execution::generate_group_6(drcuml_block &block, compiler_state &
 			UML_ADD(block, R32(Rm), R32(Rm), 1);    // add Rm, Rm, #1
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  5: // MOVWP(Rm, Rn);
@@ -3281,7 +3339,7 @@ bool sh_common_execution::generate_group_6(drcuml_block &block, compiler_state &
 			UML_ADD(block, R32(Rm), R32(Rm), 2);    // add Rm, Rm, #2
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  6: // MOVLP(Rm, Rn);
@@ -3293,7 +3351,7 @@ bool sh_common_execution::generate_group_6(drcuml_block &block, compiler_state &
 			UML_ADD(block, R32(Rm), R32(Rm), 4);    // add Rm, Rm, #4
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  8: // SWAPB(Rm, Rn);
@@ -3339,7 +3397,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write8);             // call write8
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  1 << 8: // MOVWS4(opcode & 0x0f, Rm);
@@ -3349,7 +3407,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write16);                // call write16
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  2<< 8:
@@ -3369,7 +3427,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 		UML_SEXT(block, R32(0), I0, SIZE_BYTE);         // sext R0, r0, BYTE
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  5<< 8: // MOVWL4(Rm, opcode & 0x0f);
@@ -3380,7 +3438,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 		UML_SEXT(block, R32(0), I0, SIZE_WORD);         // sext R0, r0, WORD
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  8<< 8: // CMPIM(opcode & 0xff);
@@ -3403,6 +3461,9 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 		disp = util::sext(opcode, 8);
 		m_sh2_state->ea = (desc->pc + 2) + disp * 2 + 2;    // m_sh2_state->ea = destination
 
+		if (is_idle_loop(compiler, desc))
+			UML_MOV(block, mem(&m_sh2_state->icount), 0);   // mov icount, #0 (idle loop, yield the timeslice)
+
 		generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
 		UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
 
@@ -3416,6 +3477,9 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 		disp = util::sext(opcode, 8);
 		m_sh2_state->ea = (desc->pc + 2) + disp * 2 + 2;        // m_sh2_state->ea = destination
 
+		if (is_idle_loop(compiler, desc))
+			UML_MOV(block, mem(&m_sh2_state->icount), 0);   // mov icount, #0 (idle loop, yield the timeslice)
+
 		generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
 		UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
 
@@ -3503,7 +3567,7 @@ bool sh_common_execution::generate_group_12(drcuml_block &block, compiler_state
 		UML_CALLH(block, *m_write8);             // call write8
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  1<<8: // MOVWSG(opcode & 0xff);
@@ -3513,7 +3577,7 @@ bool sh_common_execution::generate_group_12(drcuml_block &block, compiler_state
 		UML_CALLH(block, *m_write16);                // call write16
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  2<<8: // MOVLSG(opcode & 0xff);
@@ -3523,7 +3587,7 @@ bool sh_common_execution::generate_group_12(drcuml_block &block, compiler_state
 		UML_CALLH(block, *m_write32);                // call write32
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  3<<8: // TRAPA(opcode & 0xff);
@@ -3536,7 +3600,7 @@ bool sh_common_execution::generate_group_12(drcuml_block &block, compiler_state
 		UML_SEXT(block, R32(0), I0, SIZE_BYTE);         // sext R0, r0, BYTE
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  5<<8: // MOVWLG(opcode & 0xff);
@@ -3546,7 +3610,7 @@ bool sh_common_execution::generate_group_12(drcuml_block &block, compiler_state
 		UML_SEXT(block, R32(0), I0, SIZE_WORD);         // sext R0, r0, WORD
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  6<<8: // MOVLLG(opcode & 0xff);
@@ -3556,7 +3620,7 @@ bool sh_common_execution::generate_group_12(drcuml_block &block, compiler_state
 		UML_MOV(block, R32(0), I0);         // mov R0, r0
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case  7<<8: // MOVA(opcode & 0xff);
@@ -3717,7 +3781,7 @@ bool sh_common_execution::generate_group_0(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write8);             // call write8
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x05: // MOVWS0(Rm, Rn);
@@ -3729,7 +3793,7 @@ bool sh_common_execution::generate_group_0(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write16);                // call write16
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x06: // MOVLS0(Rm, Rn);
@@ -3741,7 +3805,7 @@ bool sh_common_execution::generate_group_0(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write32);                // call write32
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x07: // MULL(Rm, Rn);
@@ -3781,7 +3845,7 @@ bool sh_common_execution::generate_group_0(drcuml_block &block, compiler_state &
 		UML_SEXT(block, R32(Rn), I0, SIZE_BYTE);        // sext Rn, r0, BYTE
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x0d: // MOVWL0(Rm, Rn);
@@ -3793,7 +3857,7 @@ bool sh_common_execution::generate_group_0(drcuml_block &block, compiler_state &
 		UML_SEXT(block, R32(Rn), I0, SIZE_WORD);        // sext Rn, r0, WORD
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x0e: // MOVLL0(Rm, Rn);
@@ -3805,7 +3869,7 @@ bool sh_common_execution::generate_group_0(drcuml_block &block, compiler_state &
 		UML_MOV(block, R32(Rn), I0);            // mov Rn, r0
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x0f: // MAC_L(Rm, Rn);
@@ -3913,7 +3977,7 @@ bool sh_common_execution::generate_group_4_LDCMSR(drcuml_block &block, compiler_
 
 	compiler.checkints = true;
 	if (!in_delay_slot)
-		generate_update_cycles(block, compiler, desc->pc + 2, true);
+		generate_access_cycles(block, compiler, desc);
 	return true;
 }
 
@@ -3953,7 +4017,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write32);            // call write32
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x03: // STCMSR(Rn);
@@ -3964,7 +4028,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write32);            // call write32
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x06: // LDSMMACH(Rn);
@@ -3975,7 +4039,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		UML_MOV(block, mem(&m_sh2_state->mach), I0);    // mov mach, r0
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x07: // LDCMSR(Rn);
@@ -4082,7 +4146,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write32);            // call write32
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x13: // STCMGBR(Rn);
@@ -4093,7 +4157,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write32);            // call write32
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x16: // LDSMMACL(Rn);
@@ -4104,7 +4168,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		UML_MOV(block, mem(&m_sh2_state->macl), I0);    // mov macl, r0
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x17: // LDCMGBR(Rn);
@@ -4115,7 +4179,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		UML_MOV(block, mem(&m_sh2_state->gbr), I0); // mov gbr, r0
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x1a: // LDSMACL(Rn);
@@ -4142,7 +4206,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write8);         // write the value back
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x1e: // LDCGBR(Rn);
@@ -4172,7 +4236,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write32);                // call write32
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x23: // STCMVBR(Rn);
@@ -4183,7 +4247,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		UML_CALLH(block, *m_write32);                // call write32
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x24: // ROTCL(Rn);
@@ -4208,7 +4272,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		UML_ADD(block, R32(Rn), R32(Rn), 4);        // add Rn, Rn, #4
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x27: // LDCMVBR(Rn);
@@ -4219,7 +4283,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		UML_ADD(block, R32(Rn), R32(Rn), 4);        // add Rn, Rn, #4
 
 		if (!in_delay_slot)
-			generate_update_cycles(block, compiler, desc->pc + 2, true);
+			generate_access_cycles(block, compiler, desc);
 		return true;
 
 	case 0x2a: // LDSPR(Rn);
@@ -34,6 +34,8 @@
 #define SH2DRC_STRICT_VERIFY    0x0001          /* verify all instructions */
 #define SH2DRC_FLUSH_PC         0x0002          /* flush the PC value before each memory access */
 #define SH2DRC_STRICT_PCREL     0x0004          /* do actual loads on MOVLI/MOVWI instead of collapsing to immediates */
+#define SH2DRC_BRANCH_CYCLES    0x0008          /* only check the cycle count at branches, not after each memory access */
+#define SH2DRC_IDLE_LOOPS       0x0010          /* yield the rest of the timeslice in loops that only poll memory */
 
 #define SH2DRC_COMPATIBLE_OPTIONS   (SH2DRC_STRICT_VERIFY | SH2DRC_FLUSH_PC | SH2DRC_STRICT_PCREL)
 #define SH2DRC_FASTEST_OPTIONS  (0)
@@ -185,7 +187,8 @@ protected:
 		COMPILE_BACKWARDS_BYTES     = 64,
 		COMPILE_FORWARDS_BYTES      = 256,
 		COMPILE_MAX_INSTRUCTIONS    = (COMPILE_BACKWARDS_BYTES / 2) + (COMPILE_FORWARDS_BYTES / 2),
-		COMPILE_MAX_SEQUENCE        = 64
+		COMPILE_MAX_SEQUENCE        = 64,
+		IDLE_LOOP_MAX_BYTES         = 16
 	};
 
 	// size of the execution code cache
@@ -418,6 +421,7 @@ public:
 		uint32_t          cycles;                     /* accumulated cycles */
 		uint8_t           checkints;                  /* need to check interrupts before next instruction */
 		uml::code_label  labelnum;                   /* index for local labels */
+		const opcode_desc *desclist;                  /* descriptions for the block being compiled */
 	};
 
 	virtual void sh2_exception(const char *message, int irqline) { fatalerror("sh2_exception in base classs\n"); }
@@ -468,6 +472,8 @@ public:
 	void log_opcode_desc(const opcode_desc *desclist, int indent);
 	void log_add_disasm_comment(drcuml_block &block, uint32_t pc, uint32_t op);
 	void generate_delay_slot(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t ovrpc);
+	void generate_access_cycles(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	bool is_idle_loop(const compiler_state &compiler, const opcode_desc *branch) const;
 	void generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
 	void generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t ovrpc);
 	void static_generate_nocode_handler();
@@ -3068,7 +3068,7 @@ bool sh34_base_device::generate_group_4_LDCMSR(drcuml_block &block, compiler_sta
 
 	compiler.checkints = true;
 	if (!in_delay_slot)
-		generate_update_cycles(block, compiler, desc->pc + 2, true);
+		generate_access_cycles(block, compiler, desc);
 
 	return true;
 }
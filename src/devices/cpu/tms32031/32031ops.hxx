@@ -97,6 +97,31 @@ inline void tms3203x_device::execute_one()
 }
 
 
+// RPTS fetches its repeated opcode once and holds it, so iterate it
+// directly; the final iteration and anything unusual (the instruction
+// branching or touching the repeat registers) go back through the main
+// execute loop
+void tms3203x_device::execute_repeat_single()
+{
+	offs_t const pc = m_pc;
+	uint32_t const op = ROPCODE(pc);
+	auto const handler = s_tms32031ops[op >> 21];
+	while (true)
+	{
+		burn_cycle(1);
+		m_pc = pc + 1;
+#if (TMS_3203X_LOG_OPCODE_USAGE)
+		m_hits[op >> 21]++;
+#endif
+		(this->*handler)(op);
+
+		if (m_icount <= 0 || !(IREG(TMR_ST) & RMFLAG) || m_pc != pc + 1 || IREG(TMR_RS) != pc || IREG(TMR_RE) != pc || int32_t(IREG(TMR_RC)) <= 0)
+			break;
+		IREG(TMR_RC)--;
+	}
+}
+
+
 void tms3203x_device::update_special(int dreg)
 {
 	if (dreg == TMR_BK)
@@ -1000,6 +1000,13 @@ void tms3203x_device::execute_run()
 				continue;
 			}
 
+			// single-instruction repeats don't need to refetch
+			if ((IREG(TMR_ST) & RMFLAG) && m_pc == IREG(TMR_RS) && m_pc == IREG(TMR_RE))
+			{
+				execute_repeat_single();
+				continue;
+			}
+
 			execute_one();
 		}
 	}
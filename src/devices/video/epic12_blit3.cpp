@@ -9,6 +9,7 @@
 #define TRANSPARENT 0
 
 #include "epic12.h"
+#include "epic12span.h"
 
 /* Special Case */
 #define BLENDED 0
@@ -4,6 +4,7 @@
 
 #include "emu.h"
 #include "epic12.h"
+#include "epic12span.h"
 
 
 #define REALLY_SIMPLE 1
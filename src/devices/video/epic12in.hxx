@@ -6,6 +6,7 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 {
 	int yf;
 
+#ifndef MAME_EPIC12SPAN_SSE2
 #if REALLY_SIMPLE == 0
 	colour_t s_clr;
 #endif
@@ -38,6 +39,8 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 #else
 	u32 pen;
 #endif
+#endif
+
 	u32 *bmp;
 
 #if FLIPX == 1
@@ -81,6 +84,15 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 	if (dst_x_end > clip->max_x)
 		dimx -= (dst_x_end-1) - clip->max_x;
 
+#ifdef MAME_EPIC12SPAN_SSE2
+#if REALLY_SIMPLE == 0
+#if TINT == 1
+	const epic12span::blit_params params = { s_alpha, d_alpha, tint_clr->r, tint_clr->g, tint_clr->b };
+#else
+	const epic12span::blit_params params = { s_alpha, d_alpha, 0x20, 0x20, 0x20 };
+#endif
+#endif
+#else
 #if BLENDED == 1
 #if _SMODE == 0
 #if _DMODE == 0
@@ -102,6 +114,7 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 	const u8* dalpha_table = colrtable[d_alpha];
 #endif
 #endif
+#endif
 #endif
 
 	for (int y = starty; y < dimy; y++)
@@ -116,37 +129,21 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 			gfx2 += (src_x + startx);
 		#endif
 
-#if 1
-		const u32* end = bmp + (dimx - startx);
+#ifdef MAME_EPIC12SPAN_SSE2
+#if REALLY_SIMPLE == 1
+		epic12span::copy_row<TRANSPARENT, FLIPX>(bmp, gfx2, dimx - startx);
+#elif BLENDED == 1
+		epic12span::blend_row<_SMODE, _DMODE, TINT, TRANSPARENT, FLIPX>(bmp, gfx2, dimx - startx, params);
 #else
-		// maybe we can do some SSE type optimizations on larger blocks? right now this just results in more code and slower compiling tho.
-
-		const int width = dimx-startx;
-		const u32* end = bmp+(width);
-
-		if (width<0) return;
-
-		int bigblocks = width>>3;
-
-		while (bigblocks)
-		{
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-
-			bigblocks--;
-		}
+		epic12span::blend_row<-1, 0, TINT, TRANSPARENT, FLIPX>(bmp, gfx2, dimx - startx, params);
 #endif
+#else
+		const u32* end = bmp + (dimx - startx);
 		while (bmp < end)
 		{
 			#include "epic12pixel.hxx"
 		}
-
+#endif
 	}
 
 //  g_profiler.stop();
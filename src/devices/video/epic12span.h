@@ -0,0 +1,301 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    epic12span.h
+
+    Row kernels for the EPIC12 blitter.  Each call draws one clipped
+    destination row from a source row; when 'Flip' is set the source is
+    walked backwards from 'src'.  The colour maths is the arithmetic the
+    colrtable/colrtable_rev/colrtable_add lookup tables are built from:
+
+        mul(x, y) = min(x * y / 31, 31)
+        rev(x, y) = mul(x ^ 31, y)
+        add(x, y) = min(x + y, 31)
+
+    so the results are identical to the per-pixel code in epic12pixel.hxx
+    for 5-bit colour channels.  The generic versions do one pixel at a
+    time; when SSE2 is available the unsuffixed entry points handle eight
+    pixels at a time and fall back to the generic code for the remainder.
+
+***************************************************************************/
+
+#ifndef MAME_VIDEO_EPIC12SPAN_H
+#define MAME_VIDEO_EPIC12SPAN_H
+
+#pragma once
+
+#include <algorithm>
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_EPIC12SPAN_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace epic12span {
+
+// per-draw parameters; alphas are 5-bit, tint channels 6-bit (0x20 = 100%)
+struct blit_params
+{
+	u8 s_alpha, d_alpha;
+	u8 tint_r, tint_g, tint_b;
+};
+
+// -t-- ---- rrrr r--- gggg g--- bbbb b---
+static constexpr u32 PEN_TRANSPARENT = 0x20000000;
+
+
+//**************************************************************************
+//  REFERENCE IMPLEMENTATIONS
+//**************************************************************************
+
+namespace detail {
+
+inline u32 mul(u32 x, u32 y) { return std::min<u32>((x * y) / 0x1f, 0x1f); }
+inline u32 rev(u32 x, u32 y) { return mul(x ^ 0x1f, y); }
+inline u32 add(u32 x, u32 y) { return std::min<u32>(x + y, 0x1f); }
+
+// blend one source pen against one destination pen
+template <int SMode, int DMode, bool Tint>
+inline u32 blend_pixel(u32 pen, u32 dpen, blit_params const &p)
+{
+	u32 s[3] = { (pen >> 19) & 0x1f, (pen >> 11) & 0x1f, (pen >> 3) & 0x1f };
+	u32 const d[3] = { (dpen >> 19) & 0x1f, (dpen >> 11) & 0x1f, (dpen >> 3) & 0x1f };
+	if (Tint)
+	{
+		s[0] = mul(s[0], p.tint_r);
+		s[1] = mul(s[1], p.tint_g);
+		s[2] = mul(s[2], p.tint_b);
+	}
+
+	if (SMode >= 0)
+	{
+		u32 c[3];
+		for (int i = 0; i < 3; i++)
+		{
+			switch (SMode)
+			{
+			case 0: c[i] = mul(p.s_alpha, s[i]); break;
+			case 1: c[i] = mul(s[i], s[i]); break;
+			case 2: c[i] = mul(d[i], s[i]); break;
+			case 4: c[i] = rev(p.s_alpha, s[i]); break;
+			case 5: c[i] = rev(s[i], s[i]); break;
+			case 6: c[i] = rev(d[i], s[i]); break;
+			default: c[i] = s[i]; break;
+			}
+		}
+
+		u32 r[3];
+		for (int i = 0; i < 3; i++)
+		{
+			switch (DMode)
+			{
+			case 0: r[i] = add(c[i], mul(d[i], p.d_alpha)); break;
+			case 1: r[i] = add(c[i], mul(s[i], d[i])); break;
+			case 2: r[i] = add(c[0], mul(d[i], d[i])); break; // the hardware tables use red for every channel here
+			case 4: r[i] = add(c[i], rev(p.d_alpha, d[i])); break;
+			case 5: r[i] = add(c[i], rev(s[i], d[i])); break;
+			case 6: r[i] = add(c[i], rev(d[i], d[i])); break;
+			default: r[i] = add(c[i], d[i]); break;
+			}
+		}
+		std::copy_n(r, 3, s);
+	}
+
+	return (s[0] << 19) | (s[1] << 11) | (s[2] << 3) | (pen & PEN_TRANSPARENT);
+}
+
+} // namespace detail
+
+
+// SMode -1 draws the (optionally tinted) source without blending
+template <int SMode, int DMode, bool Tint, bool Transparent, bool Flip>
+inline void blend_row_generic(u32 *dest, const u32 *src, int count, blit_params const &p)
+{
+	int const step = Flip ? -1 : 1;
+	for (int i = 0; i < count; i++, src += step)
+		if (!Transparent || (*src & PEN_TRANSPARENT))
+			dest[i] = detail::blend_pixel<SMode, DMode, Tint>(*src, dest[i], p);
+}
+
+// untouched copy of the source pens
+template <bool Transparent, bool Flip>
+inline void copy_row_generic(u32 *dest, const u32 *src, int count)
+{
+	int const step = Flip ? -1 : 1;
+	for (int i = 0; i < count; i++, src += step)
+		if (!Transparent || (*src & PEN_TRANSPARENT))
+			dest[i] = *src;
+}
+
+
+#ifdef MAME_EPIC12SPAN_SSE2
+
+//**************************************************************************
+//  SSE2 IMPLEMENTATIONS
+//**************************************************************************
+
+namespace detail {
+
+// four source pens in destination order
+template <bool Flip>
+inline __m128i load_source(const u32 *src, int offset)
+{
+	if (!Flip)
+		return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + offset));
+	__m128i const s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src - offset - 3));
+	return _mm_shuffle_epi32(s, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+inline __m128i select(__m128i sel, __m128i a, __m128i b)
+{
+	return _mm_or_si128(_mm_and_si128(sel, a), _mm_andnot_si128(sel, b));
+}
+
+// eight pixels, one colour channel per register, 16 bits per lane
+struct channels
+{
+	channels() { }
+	channels(__m128i lo, __m128i hi)
+	{
+		__m128i const mask = _mm_set1_epi32(0x1f);
+		c[0] = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 19), mask), _mm_and_si128(_mm_srli_epi32(hi, 19), mask));
+		c[1] = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 11), mask), _mm_and_si128(_mm_srli_epi32(hi, 11), mask));
+		c[2] = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 3), mask), _mm_and_si128(_mm_srli_epi32(hi, 3), mask));
+	}
+
+	__m128i pen(int half) const
+	{
+		__m128i const zero = _mm_setzero_si128();
+		__m128i const r = half ? _mm_unpackhi_epi16(c[0], zero) : _mm_unpacklo_epi16(c[0], zero);
+		__m128i const g = half ? _mm_unpackhi_epi16(c[1], zero) : _mm_unpacklo_epi16(c[1], zero);
+		__m128i const b = half ? _mm_unpackhi_epi16(c[2], zero) : _mm_unpacklo_epi16(c[2], zero);
+		return _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, 19), _mm_slli_epi32(g, 11)), _mm_slli_epi32(b, 3));
+	}
+
+	__m128i c[3];
+};
+
+// x * y / 31 is exact as (x * y * 2115) >> 16 for all x * y <= 31 * 63
+inline __m128i mul(__m128i x, __m128i y)
+{
+	return _mm_min_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(x, y), _mm_set1_epi16(2115)), _mm_set1_epi16(0x1f));
+}
+inline __m128i rev(__m128i x, __m128i y) { return mul(_mm_xor_si128(x, _mm_set1_epi16(0x1f)), y); }
+inline __m128i add(__m128i x, __m128i y) { return _mm_min_epi16(_mm_add_epi16(x, y), _mm_set1_epi16(0x1f)); }
+
+template <int SMode, int DMode, bool Tint>
+inline void blend8(channels &s, channels const &d, blit_params const &p)
+{
+	if (Tint)
+	{
+		s.c[0] = mul(s.c[0], _mm_set1_epi16(p.tint_r));
+		s.c[1] = mul(s.c[1], _mm_set1_epi16(p.tint_g));
+		s.c[2] = mul(s.c[2], _mm_set1_epi16(p.tint_b));
+	}
+	if (SMode < 0)
+		return;
+
+	__m128i const salpha = _mm_set1_epi16(p.s_alpha);
+	__m128i const dalpha = _mm_set1_epi16(p.d_alpha);
+
+	channels c;
+	for (int i = 0; i < 3; i++)
+	{
+		switch (SMode)
+		{
+		case 0: c.c[i] = mul(salpha, s.c[i]); break;
+		case 1: c.c[i] = mul(s.c[i], s.c[i]); break;
+		case 2: c.c[i] = mul(d.c[i], s.c[i]); break;
+		case 4: c.c[i] = rev(salpha, s.c[i]); break;
+		case 5: c.c[i] = rev(s.c[i], s.c[i]); break;
+		case 6: c.c[i] = rev(d.c[i], s.c[i]); break;
+		default: c.c[i] = s.c[i]; break;
+		}
+	}
+
+	channels r;
+	for (int i = 0; i < 3; i++)
+	{
+		switch (DMode)
+		{
+		case 0: r.c[i] = add(c.c[i], mul(d.c[i], dalpha)); break;
+		case 1: r.c[i] = add(c.c[i], mul(s.c[i], d.c[i])); break;
+		case 2: r.c[i] = add(c.c[0], mul(d.c[i], d.c[i])); break;
+		case 4: r.c[i] = add(c.c[i], rev(dalpha, d.c[i])); break;
+		case 5: r.c[i] = add(c.c[i], rev(s.c[i], d.c[i])); break;
+		case 6: r.c[i] = add(c.c[i], rev(d.c[i], d.c[i])); break;
+		default: r.c[i] = add(c.c[i], d.c[i]); break;
+		}
+	}
+	s = r;
+}
+
+} // namespace detail
+
+
+template <int SMode, int DMode, bool Tint, bool Transparent, bool Flip>
+inline void blend_row(u32 *dest, const u32 *src, int count, blit_params const &p)
+{
+	__m128i const tbit = _mm_set1_epi32(PEN_TRANSPARENT);
+	int i = 0;
+	for ( ; i + 8 <= count; i += 8)
+	{
+		__m128i const src0 = detail::load_source<Flip>(src, i);
+		__m128i const src1 = detail::load_source<Flip>(src, i + 4);
+		__m128i const draw0 = _mm_cmpeq_epi32(_mm_and_si128(src0, tbit), tbit);
+		__m128i const draw1 = _mm_cmpeq_epi32(_mm_and_si128(src1, tbit), tbit);
+		if (Transparent && _mm_movemask_epi8(_mm_or_si128(draw0, draw1)) == 0)
+			continue;
+
+		__m128i *const d = reinterpret_cast<__m128i *>(&dest[i]);
+		__m128i const dst0 = _mm_loadu_si128(d);
+		__m128i const dst1 = _mm_loadu_si128(d + 1);
+		detail::channels s(src0, src1);
+		detail::blend8<SMode, DMode, Tint>(s, detail::channels(dst0, dst1), p);
+
+		__m128i const out0 = _mm_or_si128(s.pen(0), _mm_and_si128(src0, tbit));
+		__m128i const out1 = _mm_or_si128(s.pen(1), _mm_and_si128(src1, tbit));
+		_mm_storeu_si128(d, Transparent ? detail::select(draw0, out0, dst0) : out0);
+		_mm_storeu_si128(d + 1, Transparent ? detail::select(draw1, out1, dst1) : out1);
+	}
+	blend_row_generic<SMode, DMode, Tint, Transparent, Flip>(&dest[i], Flip ? (src - i) : (src + i), count - i, p);
+}
+
+template <bool Transparent, bool Flip>
+inline void copy_row(u32 *dest, const u32 *src, int count)
+{
+	__m128i const tbit = _mm_set1_epi32(PEN_TRANSPARENT);
+	int i = 0;
+	for ( ; i + 4 <= count; i += 4)
+	{
+		__m128i const s = detail::load_source<Flip>(src, i);
+		__m128i *const d = reinterpret_cast<__m128i *>(&dest[i]);
+		if (!Transparent)
+			_mm_storeu_si128(d, s);
+		else
+		{
+			__m128i const draw = _mm_cmpeq_epi32(_mm_and_si128(s, tbit), tbit);
+			int const bits = _mm_movemask_epi8(draw);
+			if (bits == 0xffff)
+				_mm_storeu_si128(d, s);
+			else if (bits != 0)
+				_mm_storeu_si128(d, detail::select(draw, s, _mm_loadu_si128(d)));
+		}
+	}
+	copy_row_generic<Transparent, Flip>(&dest[i], Flip ? (src - i) : (src + i), count - i);
+}
+
+#else // MAME_EPIC12SPAN_SSE2
+
+template <int SMode, int DMode, bool Tint, bool Transparent, bool Flip>
+inline void blend_row(u32 *dest, const u32 *src, int count, blit_params const &p) { blend_row_generic<SMode, DMode, Tint, Transparent, Flip>(dest, src, count, p); }
+template <bool Transparent, bool Flip>
+inline void copy_row(u32 *dest, const u32 *src, int count) { copy_row_generic<Transparent, Flip>(dest, src, count); }
+
+#endif // MAME_EPIC12SPAN_SSE2
+
+} // namespace epic12span
+
+#endif // MAME_VIDEO_EPIC12SPAN_H
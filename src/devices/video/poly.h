@@ -52,6 +52,7 @@
 
 static constexpr u8 POLY_FLAG_NO_WORK_QUEUE       = 0x01;
 static constexpr u8 POLY_FLAG_NO_CLIPPING         = 0x02;
+static constexpr u8 POLY_FLAG_NO_TILING           = 0x04;
 
 
 //**************************************************************************
@@ -332,8 +333,13 @@ private:
 	// number of profiling ticks before we consider a wait "long"
 	static constexpr osd_ticks_t POLY_LOG_WAIT_THRESHOLD = 1000;
 
+	// work is bucketed by tile: 32 scanlines by 256 pixels, unless tiling
+	// is disabled, in which case each bucket covers full scanlines
 	static constexpr int SCANLINES_PER_BUCKET = 32;
-	static constexpr int TOTAL_BUCKETS        = (512 / SCANLINES_PER_BUCKET);
+	static constexpr int COLUMN_SHIFT         = 8;
+	static constexpr int TOTAL_ROWS           = (512 / SCANLINES_PER_BUCKET);
+	static constexpr int TOTAL_COLUMNS        = (Flags & POLY_FLAG_NO_TILING) ? 1 : (1024 >> COLUMN_SHIFT);
+	static constexpr int TOTAL_BUCKETS        = TOTAL_ROWS * TOTAL_COLUMNS;
 
 	// primitive_info describes a single primitive
 	struct primitive_info
@@ -383,6 +389,93 @@ private:
 		return primitive;
 	}
 
+	// clip an extent to a single column, advancing the parameters past any
+	// pixels removed from the start
+	template<int ParamCount>
+	static void clip_extent_to_column(extent_t &dest, extent_t const &src, int32_t column)
+	{
+		int32_t const colstart = column << COLUMN_SHIFT;
+		int32_t const colstop = colstart + (1 << COLUMN_SHIFT);
+		bool const reversed = src.stopx < src.startx;
+		int32_t const left = reversed ? src.stopx : src.startx;
+		int32_t const right = reversed ? src.startx : src.stopx;
+		int32_t const newleft = std::clamp(left, colstart, colstop);
+		int32_t const newright = std::clamp(right, colstart, colstop);
+		int32_t const skipped = reversed ? (right - newright) : (newleft - left);
+
+		for (int paramnum = 0; paramnum < ParamCount; paramnum++)
+		{
+			dest.param[paramnum].start = src.param[paramnum].start + BaseType(skipped) * src.param[paramnum].dpdx;
+			dest.param[paramnum].dpdx = src.param[paramnum].dpdx;
+		}
+		dest.userdata = src.userdata;
+		if (newleft >= newright)
+			dest.startx = dest.stopx = 0;
+		else
+		{
+			dest.startx = reversed ? newright : newleft;
+			dest.stopx = reversed ? newleft : newright;
+		}
+	}
+
+	// file a filled-in work unit in the bucket for its tile, splitting it
+	// into one unit per column first if its extents cross column boundaries
+	template<int ParamCount>
+	void bucket_unit(uint32_t unit_index)
+	{
+		work_unit &unit = m_unit.byindex(unit_index);
+		uint32_t const row = (uint32_t(unit.scanline) / SCANLINES_PER_BUCKET) % TOTAL_ROWS;
+		int const count = unit.count_next;
+
+		// find the range of columns touched
+		int32_t firstcol = 0, lastcol = 0;
+		if (TOTAL_COLUMNS > 1)
+		{
+			int32_t minx = INT_MAX, maxx = INT_MIN;
+			for (int extnum = 0; extnum < count; extnum++)
+			{
+				extent_t const &extent = unit.extent[extnum];
+				int32_t const left = std::min(extent.startx, extent.stopx);
+				int32_t const right = std::max(extent.startx, extent.stopx);
+				if (left < right)
+				{
+					minx = std::min(minx, left);
+					maxx = std::max(maxx, right - 1);
+				}
+			}
+			if (minx <= maxx)
+			{
+				firstcol = minx >> COLUMN_SHIFT;
+				lastcol = maxx >> COLUMN_SHIFT;
+			}
+		}
+
+		// the extra columns get their own units; the original keeps the first
+		for (int32_t column = lastcol; column >= firstcol; column--)
+		{
+			uint32_t index = unit_index;
+			if (column != firstcol)
+			{
+				index = m_unit.count();
+				work_unit &split = m_unit.next();
+				split.primitive = unit.primitive;
+				split.count_next = count;
+				split.scanline = unit.scanline;
+				for (int extnum = 0; extnum < count; extnum++)
+					clip_extent_to_column<ParamCount>(split.extent[extnum], unit.extent[extnum], column);
+			}
+			else if (lastcol != firstcol)
+			{
+				for (int extnum = 0; extnum < count; extnum++)
+					clip_extent_to_column<ParamCount>(unit.extent[extnum], unit.extent[extnum], column);
+			}
+
+			uint32_t const bucketnum = row * TOTAL_COLUMNS + (uint32_t(column) % TOTAL_COLUMNS);
+			m_unit.byindex(index).previtem = m_unit_bucket[bucketnum];
+			m_unit_bucket[bucketnum] = index;
+		}
+	}
+
 	// enqueue work items in contiguous chunks
 	void queue_items(u32 start)
 	{
@@ -754,7 +847,6 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_tile(recta
 	int32_t scaninc = 1;
 	for (int32_t curscan = v1yclip; curscan < v2yclip; curscan += scaninc)
 	{
-		uint32_t bucketnum = (uint32_t(curscan) / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
 		uint32_t unit_index = m_unit.count();
 		work_unit &unit = m_unit.next();
 
@@ -765,8 +857,6 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_tile(recta
 		unit.primitive = &primitive;
 		unit.count_next = std::min(v2yclip - curscan, scaninc);
 		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
 
 		// iterate over extents
 		for (int extnum = 0; extnum < unit.count_next; extnum++)
@@ -789,6 +879,9 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_tile(recta
 				}
 			}
 		}
+
+		// file the unit under its tile
+		bucket_unit<ParamCount>(unit_index);
 	}
 
 	// enqueue the work items
@@ -895,7 +988,6 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_triangle(c
 	int32_t scaninc = 1;
 	for (int32_t curscan = v1yclip; curscan < v3yclip; curscan += scaninc)
 	{
-		uint32_t bucketnum = (uint32_t(curscan) / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
 		uint32_t unit_index = m_unit.count();
 		work_unit &unit = m_unit.next();
 
@@ -906,8 +998,6 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_triangle(c
 		unit.primitive = &primitive;
 		unit.count_next = std::min(v3yclip - curscan, scaninc);
 		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
 
 		// iterate over extents
 		for (int extnum = 0; extnum < unit.count_next; extnum++)
@@ -952,6 +1042,9 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_triangle(c
 				extent.param[paramnum].dpdx = param_dpdx[paramnum];
 			}
 		}
+
+		// file the unit under its tile
+		bucket_unit<ParamCount>(unit_index);
 	}
 
 	// enqueue the work items
@@ -1027,7 +1120,6 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_extents(re
 	int32_t scaninc = 1;
 	for (int32_t curscan = v1yclip; curscan < v3yclip; curscan += scaninc)
 	{
-		uint32_t bucketnum = (uint32_t(curscan) / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
 		uint32_t unit_index = m_unit.count();
 		work_unit &unit = m_unit.next();
 
@@ -1038,8 +1130,6 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_extents(re
 		unit.primitive = &primitive;
 		unit.count_next = std::min(v3yclip - curscan, scaninc);
 		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
 
 		// iterate over extents
 		for (int extnum = 0; extnum < unit.count_next; extnum++)
@@ -1074,6 +1164,9 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_extents(re
 			else if (istopx < istartx)
 				pixels += istartx - istopx;
 		}
+
+		// file the unit under its tile
+		bucket_unit<ParamCount>(unit_index);
 	}
 
 	// enqueue the work items
@@ -1201,7 +1294,6 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_polygon(re
 	int32_t scaninc = 1;
 	for (int32_t curscan = minyclip; curscan < maxyclip; curscan += scaninc)
 	{
-		uint32_t bucketnum = (uint32_t(curscan) / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
 		uint32_t unit_index = m_unit.count();
 		work_unit &unit = m_unit.next();
 
@@ -1212,8 +1304,6 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_polygon(re
 		unit.primitive = &primitive;
 		unit.count_next = std::min(maxyclip - curscan, scaninc);
 		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
 
 		// iterate over extents
 		for (int extnum = 0; extnum < unit.count_next; extnum++)
@@ -1271,6 +1361,9 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_polygon(re
 			extent.stopx = istopx;
 			pixels += istopx - istartx;
 		}
+
+		// file the unit under its tile
+		bucket_unit<ParamCount>(unit_index);
 	}
 
 	// enqueue the work items
@@ -45,6 +45,10 @@ psxgpu_device::psxgpu_device(const machine_config &mconfig, device_type type, co
 	: device_t(mconfig, type, tag, owner, clock)
 	, device_video_interface(mconfig, *this)
 	, device_palette_interface(mconfig, *this)
+	, m_render_queue(nullptr)
+	, m_render_fill(nullptr)
+	, m_render_next(0)
+	, m_render_discard(false)
 	, m_vblank_handler(*this)
 {
 }
@@ -68,6 +72,34 @@ void psxgpu_device::device_start()
 	{
 		psx_gpu_init( 2 );
 	}
+
+	// the debug viewer and logging both need the machine from inside the rasterizers
+	if( !PSXGPU_DEBUG_VIEWER && !VERBOSE )
+	{
+		m_render_queue = osd_work_queue_alloc( WORK_QUEUE_FLAG_HIGH_FREQ );
+		m_render_batch = std::make_unique<render_batch[]>( RENDER_BATCHES );
+		for( unsigned n_batch = 0; n_batch < RENDER_BATCHES; n_batch++ )
+		{
+			m_render_batch[ n_batch ].gpu = this;
+			m_render_batch[ n_batch ].item = nullptr;
+			m_render_batch[ n_batch ].count = 0;
+		}
+	}
+}
+
+void psxgpu_device::device_stop()
+{
+	flush_render();
+	if( m_render_queue != nullptr )
+	{
+		osd_work_queue_free( m_render_queue );
+		m_render_queue = nullptr;
+	}
+}
+
+void psxgpu_device::device_pre_save()
+{
+	flush_render();
 }
 
 void psxgpu_device::device_reset()
@@ -640,6 +672,8 @@ void psxgpu_device::psx_gpu_init( int n_gputype )
 
 void psxgpu_device::device_post_load()
 {
+	// anything still queued was issued before the state was restored
+	discard_render();
 	updatevisiblearea();
 }
 
@@ -657,6 +691,8 @@ uint32_t psxgpu_device::update_screen(screen_device &screen, bitmap_rgb32 &bitma
 	int n_overscantop;
 	int n_overscanleft;
 
+	flush_render();
+
 #if PSXGPU_DEBUG_VIEWER
 	if( DebugMeshDisplay( bitmap, cliprect ) )
 	{
@@ -822,24 +858,17 @@ f  e| d  c| b| a  9| 8  7| 6  5| 4| 3  2  1  0
     |iy|ix|ty|     |   tp|  abr|ty|         tx
 */
 
-void psxgpu_device::decode_tpage( uint32_t tpage )
+void psxgpu_device::update_tpage_status( uint32_t tpage )
 {
 	if( m_n_gputype == 2 )
 	{
 		n_gpustatus = ( n_gpustatus & 0xffff7800 ) | ( tpage & 0x7ff ) | ( ( tpage & 0x800 ) << 4 );
 
-		m_n_tx = ( tpage & 0x0f ) << 6;
-		m_n_ty = ( ( tpage & 0x10 ) << 4 ) | ( ( tpage & 0x800 ) >> 2 );
-		n_abr = ( tpage & 0x60 ) >> 5;
-		n_tp = ( tpage & 0x180 ) >> 7;
-		n_ix = ( tpage & 0x1000 ) >> 12;
-		n_iy = ( tpage & 0x2000 ) >> 13;
-		n_ti = 0;
 		if( ( tpage & ~0x39ff ) != 0 )
 		{
 			LOG("not handled: draw mode %08x\n", tpage & ~0x39ff);
 		}
-		if( n_tp == 3 )
+		if( ( ( tpage & 0x180 ) >> 7 ) == 3 )
 		{
 			logerror("not handled: tp == 3\n");
 		}
@@ -849,28 +878,45 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 		// TODO: confirm status bits on real type 1 gpu
 		n_gpustatus = ( n_gpustatus & 0xffffe000 ) | ( tpage & 0x1fff );
 
-		m_n_tx = ( tpage & 0x0f ) << 6;
-		m_n_ty = ( ( tpage & 0x60 ) << 3 );
-		n_abr = ( tpage & 0x180 ) >> 7;
-		n_tp = ( tpage & 0x600 ) >> 9;
-		n_ti = ( tpage & 0x2000 ) >> 13;
-		n_ix = 0;
-		n_iy = 0;
 		if( ( tpage & ~0x27ef ) != 0 )
 		{
 			LOG("not handled: draw mode %08x\n", tpage & ~0x27ef);
 		}
-		if( n_tp == 3 )
+		if( ( ( tpage & 0x600 ) >> 9 ) == 3 )
 		{
 			logerror("not handled: tp == 3\n");
 		}
-		else if( n_tp == 2 && n_ti != 0 )
+		else if( ( ( tpage & 0x600 ) >> 9 ) == 2 && ( tpage & 0x2000 ) != 0 )
 		{
 			logerror("not handled: interleaved 15 bit texture\n");
 		}
 	}
 }
 
+void psxgpu_device::decode_tpage( uint32_t tpage )
+{
+	if( m_n_gputype == 2 )
+	{
+		m_n_tx = ( tpage & 0x0f ) << 6;
+		m_n_ty = ( ( tpage & 0x10 ) << 4 ) | ( ( tpage & 0x800 ) >> 2 );
+		n_abr = ( tpage & 0x60 ) >> 5;
+		n_tp = ( tpage & 0x180 ) >> 7;
+		n_ix = ( tpage & 0x1000 ) >> 12;
+		n_iy = ( tpage & 0x2000 ) >> 13;
+		n_ti = 0;
+	}
+	else
+	{
+		m_n_tx = ( tpage & 0x0f ) << 6;
+		m_n_ty = ( ( tpage & 0x60 ) << 3 );
+		n_abr = ( tpage & 0x180 ) >> 7;
+		n_tp = ( tpage & 0x600 ) >> 9;
+		n_ti = ( tpage & 0x2000 ) >> 13;
+		n_ix = 0;
+		n_iy = 0;
+	}
+}
+
 #define SPRITESETUP \
 	int n_dv; \
 	if( n_iy != 0 ) \
@@ -1347,8 +1393,8 @@ static inline int CullVertex( int a, int b )
 
 #define CULLPOINT( PacketType, p1, p2 ) \
 ( \
-	CullVertex( COORD_Y( m_packet.PacketType.vertex[ p1 ].n_coord ), COORD_Y( m_packet.PacketType.vertex[ p2 ].n_coord ) ) || \
-	CullVertex( COORD_X( m_packet.PacketType.vertex[ p1 ].n_coord ), COORD_X( m_packet.PacketType.vertex[ p2 ].n_coord ) ) \
+	CullVertex( COORD_Y( packet.PacketType.vertex[ p1 ].n_coord ), COORD_Y( packet.PacketType.vertex[ p2 ].n_coord ) ) || \
+	CullVertex( COORD_X( packet.PacketType.vertex[ p1 ].n_coord ), COORD_X( packet.PacketType.vertex[ p2 ].n_coord ) ) \
 )
 
 #define CULLTRIANGLE( PacketType, start ) \
@@ -1359,7 +1405,7 @@ static inline int CullVertex( int a, int b )
 #define FINDTOPLEFT( PacketType ) \
 	for( int n_point = 0; n_point < n_points; n_point++ ) \
 	{ \
-		GET_COORD( m_packet.PacketType.vertex[ n_point ].n_coord ); \
+		GET_COORD( packet.PacketType.vertex[ n_point ].n_coord ); \
 	} \
 	\
 	const int *p_n_rightpointlist; \
@@ -1402,16 +1448,16 @@ static inline int CullVertex( int a, int b )
 	\
 	for( int n_point = n_leftpoint + 1; n_point < n_points; n_point++ ) \
 	{ \
-		if( COORD_Y( m_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_Y( m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) || \
-			( COORD_Y( m_packet.PacketType.vertex[ n_point ].n_coord ) == COORD_Y( m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) && \
-			COORD_X( m_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_X( m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) ) ) \
+		if( COORD_Y( packet.PacketType.vertex[ n_point ].n_coord ) < COORD_Y( packet.PacketType.vertex[ n_leftpoint ].n_coord ) || \
+			( COORD_Y( packet.PacketType.vertex[ n_point ].n_coord ) == COORD_Y( packet.PacketType.vertex[ n_leftpoint ].n_coord ) && \
+			COORD_X( packet.PacketType.vertex[ n_point ].n_coord ) < COORD_X( packet.PacketType.vertex[ n_leftpoint ].n_coord ) ) ) \
 		{ \
 			n_leftpoint = n_point; \
 		} \
 	} \
 	int n_rightpoint = n_leftpoint;
 
-void psxgpu_device::FlatPolygon( int n_points )
+void psxgpu_device::FlatPolygon( PACKET &packet, int n_points )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 1 )
@@ -1420,34 +1466,34 @@ void psxgpu_device::FlatPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( S11_COORD_X( m_packet.FlatPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
+		DebugMesh( S11_COORD_X( packet.FlatPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.FlatPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatPolygon.n_bgr );
+	uint8_t n_cmd = BGR_C( packet.FlatPolygon.n_bgr );
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cx2; n_cx2.d = 0;
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatPolygon.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatPolygon.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatPolygon.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( packet.FlatPolygon.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( packet.FlatPolygon.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( packet.FlatPolygon.n_bgr ); n_b.w.l = 0;
 
 	FINDTOPLEFT( FlatPolygon )
 
 	int32_t n_dx1 = 0;
 	int32_t n_dx2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( packet.FlatPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( packet.FlatPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1456,21 +1502,21 @@ void psxgpu_device::FlatPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cx1.sw.h = COORD_X( packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( packet.FlatPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1479,16 +1525,16 @@ void psxgpu_device::FlatPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cx2.sw.h = COORD_X( packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
 		}
 
 		int drawy = n_y + n_drawoffset_y;
@@ -1526,7 +1572,7 @@ void psxgpu_device::FlatPolygon( int n_points )
 	}
 }
 
-void psxgpu_device::FlatTexturedPolygon( int n_points )
+void psxgpu_device::FlatTexturedPolygon( PACKET &packet, int n_points )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 2 )
@@ -1535,15 +1581,15 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( S11_COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
+		DebugMesh( S11_COORD_X( packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatTexturedPolygon.n_bgr );
+	uint8_t n_cmd = BGR_C( packet.FlatTexturedPolygon.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cu1; n_cu1.d = 0;
@@ -1552,12 +1598,12 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	PAIR n_cu2; n_cu2.d = 0;
 	PAIR n_cv2; n_cv2.d = 0;
 
-	decode_tpage( m_packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+	decode_tpage( packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
 	TEXTURESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.FlatTexturedPolygon.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.FlatTexturedPolygon.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.FlatTexturedPolygon.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( packet.FlatTexturedPolygon.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( packet.FlatTexturedPolygon.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( packet.FlatTexturedPolygon.n_bgr ); n_b.w.l = 0;
 
 	FINDTOPLEFT( FlatTexturedPolygon )
 
@@ -1568,13 +1614,13 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	int32_t n_dv1 = 0;
 	int32_t n_dv2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( packet.FlatTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1583,25 +1629,25 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
-			n_cu1.w.h = TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
-			n_cv1.w.h = TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
+			n_cx1.sw.h = COORD_X( packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cu1.w.h = TEXTURE_U( packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
+			n_cv1.w.h = TEXTURE_V( packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
-			n_du1 = (int32_t)( ( TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
-			n_dv1 = (int32_t)( ( TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_du1 = (int32_t)( ( TEXTURE_U( packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
+			n_dv1 = (int32_t)( ( TEXTURE_V( packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( packet.FlatTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1610,20 +1656,20 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
-			n_cu2.w.h = TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
-			n_cv2.w.h = TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
+			n_cx2.sw.h = COORD_X( packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cu2.w.h = TEXTURE_U( packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
+			n_cv2.w.h = TEXTURE_V( packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
-			n_du2 = (int32_t)( ( TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
-			n_dv2 = (int32_t)( ( TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_du2 = (int32_t)( ( TEXTURE_U( packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
+			n_dv2 = (int32_t)( ( TEXTURE_V( packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
 		}
 
 		int drawy = n_y + n_drawoffset_y;
@@ -1681,7 +1727,7 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	}
 }
 
-void psxgpu_device::GouraudPolygon( int n_points )
+void psxgpu_device::GouraudPolygon( PACKET &packet, int n_points )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 3 )
@@ -1690,12 +1736,12 @@ void psxgpu_device::GouraudPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( S11_COORD_X( m_packet.GouraudPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.GouraudPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
+		DebugMesh( S11_COORD_X( packet.GouraudPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.GouraudPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.GouraudPolygon.vertex[ 0 ].n_bgr );
+	uint8_t n_cmd = BGR_C( packet.GouraudPolygon.vertex[ 0 ].n_bgr );
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cr1; n_cr1.d = 0;
@@ -1719,13 +1765,13 @@ void psxgpu_device::GouraudPolygon( int n_points )
 	int32_t n_db1 = 0;
 	int32_t n_db2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( packet.GouraudPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1734,27 +1780,27 @@ void psxgpu_device::GouraudPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
-			n_cr1.w.h = BGR_R( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
-			n_cg1.w.h = BGR_G( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
-			n_cb1.w.h = BGR_B( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
+			n_cx1.sw.h = COORD_X( packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cr1.w.h = BGR_R( packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
+			n_cg1.w.h = BGR_G( packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
+			n_cb1.w.h = BGR_B( packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
-			n_dr1 = (int32_t)( ( BGR_R( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
-			n_dg1 = (int32_t)( ( BGR_G( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
-			n_db1 = (int32_t)( ( BGR_B( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_dr1 = (int32_t)( ( BGR_R( packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
+			n_dg1 = (int32_t)( ( BGR_G( packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
+			n_db1 = (int32_t)( ( BGR_B( packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( packet.GouraudPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1763,22 +1809,22 @@ void psxgpu_device::GouraudPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
-			n_cr2.w.h = BGR_R( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
-			n_cg2.w.h = BGR_G( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
-			n_cb2.w.h = BGR_B( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
+			n_cx2.sw.h = COORD_X( packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cr2.w.h = BGR_R( packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
+			n_cg2.w.h = BGR_G( packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
+			n_cb2.w.h = BGR_B( packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
-			n_dr2 = (int32_t)( ( BGR_R( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
-			n_dg2 = (int32_t)( ( BGR_G( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
-			n_db2 = (int32_t)( ( BGR_B( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_dr2 = (int32_t)( ( BGR_R( packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
+			n_dg2 = (int32_t)( ( BGR_G( packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
+			n_db2 = (int32_t)( ( BGR_B( packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
 		}
 
 		int drawy = n_y + n_drawoffset_y;
@@ -1845,7 +1891,7 @@ void psxgpu_device::GouraudPolygon( int n_points )
 	}
 }
 
-void psxgpu_device::GouraudTexturedPolygon( int n_points )
+void psxgpu_device::GouraudTexturedPolygon( PACKET &packet, int n_points )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 4 )
@@ -1854,15 +1900,15 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( S11_COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
+		DebugMesh( S11_COORD_X( packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_bgr );
+	uint8_t n_cmd = BGR_C( packet.GouraudTexturedPolygon.vertex[ 0 ].n_bgr );
 
-	uint32_t n_clutx = ( m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cr1; n_cr1.d = 0;
@@ -1877,7 +1923,7 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	PAIR n_cu2; n_cu2.d = 0;
 	PAIR n_cv2; n_cv2.d = 0;
 
-	decode_tpage( m_packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+	decode_tpage( packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
 	TEXTURESETUP
 
 	FINDTOPLEFT( GouraudTexturedPolygon )
@@ -1895,13 +1941,13 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	int32_t n_dv1 = 0;
 	int32_t n_dv2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( packet.GouraudTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1910,31 +1956,31 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
-			n_cr1.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
-			n_cg1.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
-			n_cb1.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
-			n_cu1.w.h = TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
-			n_cv1.w.h = TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
+			n_cx1.sw.h = COORD_X( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cr1.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
+			n_cg1.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
+			n_cb1.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
+			n_cu1.w.h = TEXTURE_U( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
+			n_cv1.w.h = TEXTURE_V( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
-			n_dr1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
-			n_dg1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
-			n_db1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
-			n_du1 = (int32_t)( ( TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
-			n_dv1 = (int32_t)( ( TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_dr1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
+			n_dg1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
+			n_db1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
+			n_du1 = (int32_t)( ( TEXTURE_U( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
+			n_dv1 = (int32_t)( ( TEXTURE_V( packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( packet.GouraudTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1943,26 +1989,26 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
-			n_cr2.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
-			n_cg2.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
-			n_cb2.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
-			n_cu2.w.h = TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
-			n_cv2.w.h = TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
+			n_cx2.sw.h = COORD_X( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cr2.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
+			n_cg2.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
+			n_cb2.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
+			n_cu2.w.h = TEXTURE_U( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
+			n_cv2.w.h = TEXTURE_V( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
-			n_dr2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
-			n_dg2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
-			n_db2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
-			n_du2 = (int32_t)( ( TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
-			n_dv2 = (int32_t)( ( TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_dr2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
+			n_dg2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
+			n_db2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
+			n_du2 = (int32_t)( ( TEXTURE_U( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
+			n_dv2 = (int32_t)( ( TEXTURE_V( packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
 		}
 
 		int drawy = n_y + n_drawoffset_y;
@@ -2047,27 +2093,27 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	}
 }
 
-void psxgpu_device::MonochromeLine()
+void psxgpu_device::MonochromeLine( PACKET &packet )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 5 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.MonochromeLine.vertex[ 0 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.MonochromeLine.vertex[ 0 ].n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.MonochromeLine.vertex[ 1 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.MonochromeLine.vertex[ 1 ].n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.MonochromeLine.vertex[ 0 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.MonochromeLine.vertex[ 0 ].n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.MonochromeLine.vertex[ 1 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.MonochromeLine.vertex[ 1 ].n_coord ) + n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	int32_t n_xstart = S11_COORD_X( m_packet.MonochromeLine.vertex[ 0 ].n_coord );
-	int32_t n_xend = S11_COORD_X( m_packet.MonochromeLine.vertex[ 1 ].n_coord );
-	int32_t n_ystart = S11_COORD_Y( m_packet.MonochromeLine.vertex[ 0 ].n_coord );
-	int32_t n_yend = S11_COORD_Y( m_packet.MonochromeLine.vertex[ 1 ].n_coord );
+	int32_t n_xstart = S11_COORD_X( packet.MonochromeLine.vertex[ 0 ].n_coord );
+	int32_t n_xend = S11_COORD_X( packet.MonochromeLine.vertex[ 1 ].n_coord );
+	int32_t n_ystart = S11_COORD_Y( packet.MonochromeLine.vertex[ 0 ].n_coord );
+	int32_t n_yend = S11_COORD_Y( packet.MonochromeLine.vertex[ 1 ].n_coord );
 
-	uint8_t n_cmd = BGR_C( m_packet.MonochromeLine.n_bgr );
-	uint8_t n_r = BGR_R( m_packet.MonochromeLine.n_bgr );
-	uint8_t n_g = BGR_G( m_packet.MonochromeLine.n_bgr );
-	uint8_t n_b = BGR_B( m_packet.MonochromeLine.n_bgr );
+	uint8_t n_cmd = BGR_C( packet.MonochromeLine.n_bgr );
+	uint8_t n_r = BGR_R( packet.MonochromeLine.n_bgr );
+	uint8_t n_g = BGR_G( packet.MonochromeLine.n_bgr );
+	uint8_t n_b = BGR_B( packet.MonochromeLine.n_bgr );
 
 	TRANSPARENCYSETUP
 
@@ -2147,33 +2193,33 @@ void psxgpu_device::MonochromeLine()
 	}
 }
 
-void psxgpu_device::GouraudLine()
+void psxgpu_device::GouraudLine( PACKET &packet )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 6 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.GouraudLine.vertex[ 0 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.GouraudLine.vertex[ 0 ].n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.GouraudLine.vertex[ 1 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.GouraudLine.vertex[ 1 ].n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.GouraudLine.vertex[ 0 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.GouraudLine.vertex[ 0 ].n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.GouraudLine.vertex[ 1 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.GouraudLine.vertex[ 1 ].n_coord ) + n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.GouraudLine.vertex[ 0 ].n_bgr );
+	uint8_t n_cmd = BGR_C( packet.GouraudLine.vertex[ 0 ].n_bgr );
 
 	TRANSPARENCYSETUP
 
-	int32_t n_xstart = S11_COORD_X( m_packet.GouraudLine.vertex[ 0 ].n_coord );
-	int32_t n_ystart = S11_COORD_Y( m_packet.GouraudLine.vertex[ 0 ].n_coord );
-	PAIR n_cr1; n_cr1.w.h = BGR_R( m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cr1.w.l = 0;
-	PAIR n_cg1; n_cg1.w.h = BGR_G( m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cg1.w.l = 0;
-	PAIR n_cb1; n_cb1.w.h = BGR_B( m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cb1.w.l = 0;
+	int32_t n_xstart = S11_COORD_X( packet.GouraudLine.vertex[ 0 ].n_coord );
+	int32_t n_ystart = S11_COORD_Y( packet.GouraudLine.vertex[ 0 ].n_coord );
+	PAIR n_cr1; n_cr1.w.h = BGR_R( packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cr1.w.l = 0;
+	PAIR n_cg1; n_cg1.w.h = BGR_G( packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cg1.w.l = 0;
+	PAIR n_cb1; n_cb1.w.h = BGR_B( packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cb1.w.l = 0;
 
-	int32_t n_xend = S11_COORD_X( m_packet.GouraudLine.vertex[ 1 ].n_coord );
-	int32_t n_yend = S11_COORD_Y( m_packet.GouraudLine.vertex[ 1 ].n_coord );
-	PAIR n_cr2; n_cr2.w.h = BGR_R( m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cr2.w.l = 0;
-	PAIR n_cg2; n_cg2.w.h = BGR_G( m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cg2.w.l = 0;
-	PAIR n_cb2; n_cb2.w.h = BGR_B( m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cb2.w.l = 0;
+	int32_t n_xend = S11_COORD_X( packet.GouraudLine.vertex[ 1 ].n_coord );
+	int32_t n_yend = S11_COORD_Y( packet.GouraudLine.vertex[ 1 ].n_coord );
+	PAIR n_cr2; n_cr2.w.h = BGR_R( packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cr2.w.l = 0;
+	PAIR n_cg2; n_cg2.w.h = BGR_G( packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cg2.w.l = 0;
+	PAIR n_cb2; n_cb2.w.h = BGR_B( packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cb2.w.l = 0;
 
 
 	PAIR n_x; n_x.sw.h = n_xstart; n_x.sw.l = 0;
@@ -2261,31 +2307,31 @@ void psxgpu_device::GouraudLine()
 	}
 }
 
-void psxgpu_device::FrameBufferRectangleDraw()
+void psxgpu_device::FrameBufferRectangleDraw( PACKET &packet )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 7 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + SIZE_W( m_packet.FlatRectangle.n_size ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + SIZE_H( m_packet.FlatRectangle.n_size ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + SIZE_W( m_packet.FlatRectangle.n_size ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + SIZE_H( m_packet.FlatRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle.n_coord ), S11_COORD_Y( packet.FlatRectangle.n_coord ) );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle.n_coord ) + SIZE_W( packet.FlatRectangle.n_size ), S11_COORD_Y( packet.FlatRectangle.n_coord ) );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle.n_coord ), S11_COORD_Y( packet.FlatRectangle.n_coord ) + SIZE_H( packet.FlatRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle.n_coord ) + SIZE_W( packet.FlatRectangle.n_size ), S11_COORD_Y( packet.FlatRectangle.n_coord ) + SIZE_H( packet.FlatRectangle.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_y = COORD_Y( m_packet.FlatRectangle.n_coord );
-	int32_t n_h = SIZE_H( m_packet.FlatRectangle.n_size );
+	int16_t n_y = COORD_Y( packet.FlatRectangle.n_coord );
+	int32_t n_h = SIZE_H( packet.FlatRectangle.n_size );
 
 	while( n_h > 0 )
 	{
-		int16_t n_x = COORD_X( m_packet.FlatRectangle.n_coord );
-		int32_t n_distance = SIZE_W( m_packet.FlatRectangle.n_size );
+		int16_t n_x = COORD_X( packet.FlatRectangle.n_coord );
+		int32_t n_distance = SIZE_W( packet.FlatRectangle.n_size );
 
 		while( n_distance > 0 )
 		{
@@ -2302,35 +2348,35 @@ void psxgpu_device::FrameBufferRectangleDraw()
 	}
 }
 
-void psxgpu_device::FlatRectangle()
+void psxgpu_device::FlatRectangle( PACKET &packet )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 8 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_packet.FlatRectangle.n_size ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_packet.FlatRectangle.n_size ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_packet.FlatRectangle.n_size ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_packet.FlatRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.FlatRectangle.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle.n_coord ) + n_drawoffset_x + SIZE_W( packet.FlatRectangle.n_size ), S11_COORD_Y( packet.FlatRectangle.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.FlatRectangle.n_coord ) + n_drawoffset_y + SIZE_H( packet.FlatRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle.n_coord ) + n_drawoffset_x + SIZE_W( packet.FlatRectangle.n_size ), S11_COORD_Y( packet.FlatRectangle.n_coord ) + n_drawoffset_y + SIZE_H( packet.FlatRectangle.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatRectangle.n_bgr );
+	uint8_t n_cmd = BGR_C( packet.FlatRectangle.n_bgr );
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.FlatRectangle.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.FlatRectangle.n_coord );
-	int32_t n_h = SIZE_H( m_packet.FlatRectangle.n_size );
+	int16_t n_x = S11_COORD_X( packet.FlatRectangle.n_coord );
+	int16_t n_y = S11_COORD_Y( packet.FlatRectangle.n_coord );
+	int32_t n_h = SIZE_H( packet.FlatRectangle.n_size );
 
 	while( n_h > 0 )
 	{
-		int32_t n_distance = SIZE_W( m_packet.FlatRectangle.n_size );
+		int32_t n_distance = SIZE_W( packet.FlatRectangle.n_size );
 		int drawy = n_y + n_drawoffset_y;
 
 		if( n_distance > 0 && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
@@ -2351,30 +2397,30 @@ void psxgpu_device::FlatRectangle()
 	}
 }
 
-void psxgpu_device::FlatRectangle8x8()
+void psxgpu_device::FlatRectangle8x8( PACKET &packet )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 9 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x + 8, S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y + 8 );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x + 8, S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y + 8 );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x + 8, S11_COORD_Y( packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y + 8 );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x + 8, S11_COORD_Y( packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y + 8 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatRectangle8x8.n_bgr );
+	uint8_t n_cmd = BGR_C( packet.FlatRectangle8x8.n_bgr );
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle8x8.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle8x8.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle8x8.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( packet.FlatRectangle8x8.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( packet.FlatRectangle8x8.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( packet.FlatRectangle8x8.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.FlatRectangle8x8.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord );
+	int16_t n_x = S11_COORD_X( packet.FlatRectangle8x8.n_coord );
+	int16_t n_y = S11_COORD_Y( packet.FlatRectangle8x8.n_coord );
 	int32_t n_h = 8;
 
 	while( n_h > 0 )
@@ -2400,30 +2446,30 @@ void psxgpu_device::FlatRectangle8x8()
 	}
 }
 
-void psxgpu_device::FlatRectangle16x16()
+void psxgpu_device::FlatRectangle16x16( PACKET &packet )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 10 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x + 16, S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y + 16 );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x + 16, S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y + 16 );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x + 16, S11_COORD_Y( packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y + 16 );
+	DebugMesh( S11_COORD_X( packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x + 16, S11_COORD_Y( packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y + 16 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatRectangle16x16.n_bgr );
+	uint8_t n_cmd = BGR_C( packet.FlatRectangle16x16.n_bgr );
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle16x16.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle16x16.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle16x16.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( packet.FlatRectangle16x16.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( packet.FlatRectangle16x16.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( packet.FlatRectangle16x16.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.FlatRectangle16x16.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord );
+	int16_t n_x = S11_COORD_X( packet.FlatRectangle16x16.n_coord );
+	int16_t n_y = S11_COORD_Y( packet.FlatRectangle16x16.n_coord );
 	int32_t n_h = 16;
 
 	while( n_h > 0 )
@@ -2449,41 +2495,41 @@ void psxgpu_device::FlatRectangle16x16()
 	}
 }
 
-void psxgpu_device::FlatTexturedRectangle()
+void psxgpu_device::FlatTexturedRectangle( PACKET &packet )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 11 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_packet.FlatTexturedRectangle.n_size ), S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_packet.FlatTexturedRectangle.n_size ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_packet.FlatTexturedRectangle.n_size ), S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_packet.FlatTexturedRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x + SIZE_W( packet.FlatTexturedRectangle.n_size ), S11_COORD_Y( packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y + SIZE_H( packet.FlatTexturedRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x + SIZE_W( packet.FlatTexturedRectangle.n_size ), S11_COORD_Y( packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y + SIZE_H( packet.FlatTexturedRectangle.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatTexturedRectangle.n_bgr );
+	uint8_t n_cmd = BGR_C( packet.FlatTexturedRectangle.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.FlatTexturedRectangle.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.FlatTexturedRectangle.n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( packet.FlatTexturedRectangle.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( packet.FlatTexturedRectangle.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 	SPRITESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.FlatTexturedRectangle.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.FlatTexturedRectangle.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.FlatTexturedRectangle.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( packet.FlatTexturedRectangle.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( packet.FlatTexturedRectangle.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( packet.FlatTexturedRectangle.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord );
-	uint8_t n_v = TEXTURE_V( m_packet.FlatTexturedRectangle.n_texture );
-	uint32_t n_h = SIZE_H( m_packet.FlatTexturedRectangle.n_size );
+	int16_t n_x = S11_COORD_X( packet.FlatTexturedRectangle.n_coord );
+	int16_t n_y = S11_COORD_Y( packet.FlatTexturedRectangle.n_coord );
+	uint8_t n_v = TEXTURE_V( packet.FlatTexturedRectangle.n_texture );
+	uint32_t n_h = SIZE_H( packet.FlatTexturedRectangle.n_size );
 
 	while( n_h > 0 )
 	{
-		uint8_t n_u = TEXTURE_U( m_packet.FlatTexturedRectangle.n_texture );
-		int16_t n_distance = SIZE_W( m_packet.FlatTexturedRectangle.n_size );
+		uint8_t n_u = TEXTURE_U( packet.FlatTexturedRectangle.n_texture );
+		int16_t n_distance = SIZE_W( packet.FlatTexturedRectangle.n_size );
 		int drawy = n_y + n_drawoffset_y;
 
 		if( n_distance > 0 && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
@@ -2506,40 +2552,40 @@ void psxgpu_device::FlatTexturedRectangle()
 	}
 }
 
-void psxgpu_device::Sprite8x8()
+void psxgpu_device::Sprite8x8( PACKET &packet )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 12 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.Sprite8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Sprite8x8.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.Sprite8x8.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_packet.Sprite8x8.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.Sprite8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Sprite8x8.n_coord ) + n_drawoffset_y + 7 );
-	DebugMesh( S11_COORD_X( m_packet.Sprite8x8.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_packet.Sprite8x8.n_coord ) + n_drawoffset_y + 7 );
+	DebugMesh( S11_COORD_X( packet.Sprite8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.Sprite8x8.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.Sprite8x8.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( packet.Sprite8x8.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.Sprite8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.Sprite8x8.n_coord ) + n_drawoffset_y + 7 );
+	DebugMesh( S11_COORD_X( packet.Sprite8x8.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( packet.Sprite8x8.n_coord ) + n_drawoffset_y + 7 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.Sprite8x8.n_bgr );
+	uint8_t n_cmd = BGR_C( packet.Sprite8x8.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.Sprite8x8.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.Sprite8x8.n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( packet.Sprite8x8.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( packet.Sprite8x8.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 	SPRITESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.Sprite8x8.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.Sprite8x8.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.Sprite8x8.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( packet.Sprite8x8.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( packet.Sprite8x8.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( packet.Sprite8x8.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.Sprite8x8.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.Sprite8x8.n_coord );
-	uint8_t n_v = TEXTURE_V( m_packet.Sprite8x8.n_texture );
+	int16_t n_x = S11_COORD_X( packet.Sprite8x8.n_coord );
+	int16_t n_y = S11_COORD_Y( packet.Sprite8x8.n_coord );
+	uint8_t n_v = TEXTURE_V( packet.Sprite8x8.n_texture );
 	uint32_t n_h = 8;
 
 	while( n_h > 0 )
 	{
-		uint8_t n_u = TEXTURE_U( m_packet.Sprite8x8.n_texture );
+		uint8_t n_u = TEXTURE_U( packet.Sprite8x8.n_texture );
 		int16_t n_distance = 8;
 
 		int drawy = n_y + n_drawoffset_y;
@@ -2564,40 +2610,40 @@ void psxgpu_device::Sprite8x8()
 	}
 }
 
-void psxgpu_device::Sprite16x16()
+void psxgpu_device::Sprite16x16( PACKET &packet )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 13 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.Sprite16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Sprite16x16.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.Sprite16x16.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_packet.Sprite16x16.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.Sprite16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Sprite16x16.n_coord ) + n_drawoffset_y + 7 );
-	DebugMesh( S11_COORD_X( m_packet.Sprite16x16.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_packet.Sprite16x16.n_coord ) + n_drawoffset_y + 7 );
+	DebugMesh( S11_COORD_X( packet.Sprite16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.Sprite16x16.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.Sprite16x16.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( packet.Sprite16x16.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.Sprite16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.Sprite16x16.n_coord ) + n_drawoffset_y + 7 );
+	DebugMesh( S11_COORD_X( packet.Sprite16x16.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( packet.Sprite16x16.n_coord ) + n_drawoffset_y + 7 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.Sprite16x16.n_bgr );
+	uint8_t n_cmd = BGR_C( packet.Sprite16x16.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.Sprite16x16.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.Sprite16x16.n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( packet.Sprite16x16.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( packet.Sprite16x16.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 	SPRITESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.Sprite16x16.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.Sprite16x16.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.Sprite16x16.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( packet.Sprite16x16.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( packet.Sprite16x16.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( packet.Sprite16x16.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.Sprite16x16.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.Sprite16x16.n_coord );
-	uint8_t n_v = TEXTURE_V( m_packet.Sprite16x16.n_texture );
+	int16_t n_x = S11_COORD_X( packet.Sprite16x16.n_coord );
+	int16_t n_y = S11_COORD_Y( packet.Sprite16x16.n_coord );
+	uint8_t n_v = TEXTURE_V( packet.Sprite16x16.n_texture );
 	uint32_t n_h = 16;
 
 	while( n_h > 0 )
 	{
-		uint8_t n_u = TEXTURE_U( m_packet.Sprite16x16.n_texture );
+		uint8_t n_u = TEXTURE_U( packet.Sprite16x16.n_texture );
 		int16_t n_distance = 16;
 
 		int drawy = n_y + n_drawoffset_y;
@@ -2622,23 +2668,23 @@ void psxgpu_device::Sprite16x16()
 	}
 }
 
-void psxgpu_device::Dot()
+void psxgpu_device::Dot( PACKET &packet )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 14 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.Dot.vertex.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Dot.vertex.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.Dot.vertex.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.Dot.vertex.n_coord ) + n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.Dot.n_bgr );
-	uint8_t n_r = BGR_R( m_packet.Dot.n_bgr );
-	uint8_t n_g = BGR_G( m_packet.Dot.n_bgr );
-	uint8_t n_b = BGR_B( m_packet.Dot.n_bgr );
-	int32_t n_x = S11_COORD_X( m_packet.Dot.vertex.n_coord );
-	int32_t n_y = S11_COORD_Y( m_packet.Dot.vertex.n_coord );
+	uint8_t n_cmd = BGR_C( packet.Dot.n_bgr );
+	uint8_t n_r = BGR_R( packet.Dot.n_bgr );
+	uint8_t n_g = BGR_G( packet.Dot.n_bgr );
+	uint8_t n_b = BGR_B( packet.Dot.n_bgr );
+	int32_t n_x = S11_COORD_X( packet.Dot.vertex.n_coord );
+	int32_t n_y = S11_COORD_Y( packet.Dot.vertex.n_coord );
 
 	TRANSPARENCYSETUP
 
@@ -2670,29 +2716,29 @@ void psxgpu_device::Dot()
 	}
 }
 
-void psxgpu_device::TexturedDot()
+void psxgpu_device::TexturedDot( PACKET &packet )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if (m_debug.n_skip == 15)
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.TexturedDot.vertex.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.TexturedDot.vertex.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( packet.TexturedDot.vertex.n_coord ) + n_drawoffset_x, S11_COORD_Y( packet.TexturedDot.vertex.n_coord ) + n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.TexturedDot.n_bgr );
+	uint8_t n_cmd = BGR_C( packet.TexturedDot.n_bgr );
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.TexturedDot.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.TexturedDot.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.TexturedDot.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( packet.TexturedDot.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( packet.TexturedDot.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( packet.TexturedDot.n_bgr ); n_b.w.l = 0;
 
-	int32_t n_x = S11_COORD_X( m_packet.TexturedDot.vertex.n_coord );
-	int32_t n_y = S11_COORD_Y( m_packet.TexturedDot.vertex.n_coord );
-	uint8_t n_u = TEXTURE_U(m_packet.TexturedDot.vertex.n_texture );
-	uint8_t n_v = TEXTURE_V(m_packet.TexturedDot.vertex.n_texture );
-	uint32_t n_clutx = ( m_packet.TexturedDot.vertex.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.TexturedDot.vertex.n_texture.w.h >> 6 ) & 0x3ff;
+	int32_t n_x = S11_COORD_X( packet.TexturedDot.vertex.n_coord );
+	int32_t n_y = S11_COORD_Y( packet.TexturedDot.vertex.n_coord );
+	uint8_t n_u = TEXTURE_U(packet.TexturedDot.vertex.n_texture );
+	uint8_t n_v = TEXTURE_V(packet.TexturedDot.vertex.n_texture );
+	uint32_t n_clutx = ( packet.TexturedDot.vertex.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( packet.TexturedDot.vertex.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 
@@ -2708,29 +2754,29 @@ void psxgpu_device::TexturedDot()
 	}
 }
 
-void psxgpu_device::MoveImage()
+void psxgpu_device::MoveImage( PACKET &packet )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 16 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ), S11_COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) );
-	DebugMesh( S11_COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_W( m_packet.MoveImage.n_size ), S11_COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) );
-	DebugMesh( S11_COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ), S11_COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_H( m_packet.MoveImage.n_size ) );
-	DebugMesh( S11_COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_W( m_packet.MoveImage.n_size ), S11_COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_H( m_packet.MoveImage.n_size ) );
+	DebugMesh( S11_COORD_X( packet.MoveImage.vertex[ 1 ].n_coord ), S11_COORD_Y( packet.MoveImage.vertex[ 1 ].n_coord ) );
+	DebugMesh( S11_COORD_X( packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_W( packet.MoveImage.n_size ), S11_COORD_Y( packet.MoveImage.vertex[ 1 ].n_coord ) );
+	DebugMesh( S11_COORD_X( packet.MoveImage.vertex[ 1 ].n_coord ), S11_COORD_Y( packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_H( packet.MoveImage.n_size ) );
+	DebugMesh( S11_COORD_X( packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_W( packet.MoveImage.n_size ), S11_COORD_Y( packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_H( packet.MoveImage.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	int16_t n_srcy = COORD_Y( m_packet.MoveImage.vertex[ 0 ].n_coord );
-	int16_t n_dsty = COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord );
-	int16_t n_h = SIZE_H( m_packet.MoveImage.n_size );
+	int16_t n_srcy = COORD_Y( packet.MoveImage.vertex[ 0 ].n_coord );
+	int16_t n_dsty = COORD_Y( packet.MoveImage.vertex[ 1 ].n_coord );
+	int16_t n_h = SIZE_H( packet.MoveImage.n_size );
 
 	while( n_h > 0 )
 	{
-		int16_t n_srcx = COORD_X( m_packet.MoveImage.vertex[ 0 ].n_coord );
-		int16_t n_dstx = COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord );
-		int16_t n_w = SIZE_W( m_packet.MoveImage.n_size );
+		int16_t n_srcx = COORD_X( packet.MoveImage.vertex[ 0 ].n_coord );
+		int16_t n_dstx = COORD_X( packet.MoveImage.vertex[ 1 ].n_coord );
+		int16_t n_w = SIZE_W( packet.MoveImage.n_size );
 
 		while( n_w > 0 )
 		{
@@ -2747,9 +2793,310 @@ void psxgpu_device::MoveImage()
 	}
 }
 
+void psxgpu_device::execute_command( PACKET &packet )
+{
+	switch( packet.n_entry[ 0 ] >> 24 )
+	{
+	case 0x02:
+		FrameBufferRectangleDraw( packet );
+		break;
+	case 0x20:
+	case 0x21:
+	case 0x22:
+	case 0x23:
+		FlatPolygon( packet, 3 );
+		break;
+	case 0x24:
+	case 0x25:
+	case 0x26:
+	case 0x27:
+		FlatTexturedPolygon( packet, 3 );
+		break;
+	case 0x28:
+	case 0x29:
+	case 0x2a:
+	case 0x2b:
+		FlatPolygon( packet, 4 );
+		break;
+	case 0x2c:
+	case 0x2d:
+	case 0x2e:
+	case 0x2f:
+		FlatTexturedPolygon( packet, 4 );
+		break;
+	case 0x30:
+	case 0x31:
+	case 0x32:
+	case 0x33:
+		GouraudPolygon( packet, 3 );
+		break;
+	case 0x34:
+	case 0x35:
+	case 0x36:
+	case 0x37:
+		GouraudTexturedPolygon( packet, 3 );
+		break;
+	case 0x38:
+	case 0x39:
+	case 0x3a:
+	case 0x3b:
+		GouraudPolygon( packet, 4 );
+		break;
+	case 0x3c:
+	case 0x3d:
+	case 0x3e:
+	case 0x3f:
+		GouraudTexturedPolygon( packet, 4 );
+		break;
+	case 0x40:
+	case 0x41:
+	case 0x42:
+	case 0x43:
+	case 0x48:
+	case 0x4a:
+	case 0x4c:
+	case 0x4e:
+		MonochromeLine( packet );
+		break;
+	case 0x50:
+	case 0x51:
+	case 0x52:
+	case 0x53:
+	case 0x58:
+	case 0x5a:
+	case 0x5c:
+	case 0x5e:
+		GouraudLine( packet );
+		break;
+	case 0x60:
+	case 0x61:
+	case 0x62:
+	case 0x63:
+		FlatRectangle( packet );
+		break;
+	case 0x64:
+	case 0x65:
+	case 0x66:
+	case 0x67:
+		FlatTexturedRectangle( packet );
+		break;
+	case 0x68:
+	case 0x69:
+	case 0x6a:
+	case 0x6b:
+		Dot( packet );
+		break;
+	case 0x6c:
+	case 0x6d:
+	case 0x6e:
+	case 0x6f:
+		TexturedDot( packet );
+		break;
+	case 0x70:
+	case 0x71:
+	case 0x72:
+	case 0x73:
+		FlatRectangle8x8( packet );
+		break;
+	case 0x74:
+	case 0x75:
+	case 0x76:
+	case 0x77:
+		Sprite8x8( packet );
+		break;
+	case 0x78:
+	case 0x79:
+	case 0x7a:
+	case 0x7b:
+		FlatRectangle16x16( packet );
+		break;
+	case 0x7c:
+	case 0x7d:
+	case 0x7e:
+	case 0x7f:
+		Sprite16x16( packet );
+		break;
+	case 0x80:
+		MoveImage( packet );
+		break;
+	case 0xe1:
+		decode_tpage( packet.n_entry[ 0 ] & 0xffffff );
+		break;
+	case 0xe2:
+		n_twy = ( ( ( packet.n_entry[ 0 ] >> 15 ) & 0x1f ) << 3 );
+		n_twx = ( ( ( packet.n_entry[ 0 ] >> 10 ) & 0x1f ) << 3 );
+		n_twh = 255 - ( ( ( packet.n_entry[ 0 ] >> 5 ) & 0x1f ) << 3 );
+		n_tww = 255 - ( ( packet.n_entry[ 0 ] & 0x1f ) << 3 );
+		break;
+	case 0xe3:
+		n_drawarea_x1 = packet.n_entry[ 0 ] & 1023;
+		if( m_n_gputype == 2 )
+		{
+			n_drawarea_y1 = ( packet.n_entry[ 0 ] >> 10 ) & 1023;
+		}
+		else
+		{
+			n_drawarea_y1 = ( packet.n_entry[ 0 ] >> 12 ) & 1023;
+		}
+		break;
+	case 0xe4:
+		n_drawarea_x2 = packet.n_entry[ 0 ] & 1023;
+		if( m_n_gputype == 2 )
+		{
+			n_drawarea_y2 = ( packet.n_entry[ 0 ] >> 10 ) & 1023;
+		}
+		else
+		{
+			n_drawarea_y2 = ( packet.n_entry[ 0 ] >> 12 ) & 1023;
+		}
+		break;
+	case 0xe5:
+		n_drawoffset_x = util::sext( packet.n_entry[ 0 ] & 2047, 11 );
+		if( m_n_gputype == 2 )
+		{
+			n_drawoffset_y = util::sext( ( packet.n_entry[ 0 ] >> 11 ) & 2047, 11 );
+		}
+		else
+		{
+			n_drawoffset_y = util::sext( ( packet.n_entry[ 0 ] >> 12 ) & 2047, 11 );
+		}
+		break;
+	case 0xe6:
+		m_draw_stp = BIT( packet.n_entry[ 0 ], 0 );
+		m_check_stp = BIT( packet.n_entry[ 0 ], 1 );
+		break;
+	}
+}
+
+/*
+Completed drawing and drawing state packets are copied into a batch which
+is executed in order on a single worker thread, so the rasterizers and the
+drawing state (texture page, texture window, drawing area and offset, mask
+bits) belong to that thread while it is running.  Anything that reads or
+writes vram or that state directly has to call flush_render() first.
+*/
+
+void psxgpu_device::queue_command()
+{
+	if( m_render_queue == nullptr )
+	{
+		PACKET packet = m_packet;
+		execute_command( packet );
+		return;
+	}
+
+	if( m_render_fill == nullptr )
+	{
+		// reuse the oldest batch, waiting for it if it is still being drawn
+		render_batch &batch = m_render_batch[ m_render_next ];
+		if( batch.item != nullptr )
+		{
+			osd_work_item_wait( batch.item, osd_ticks_per_second() * 100 );
+			osd_work_item_release( batch.item );
+			batch.item = nullptr;
+		}
+		batch.count = 0;
+		m_render_fill = &batch;
+	}
+
+	m_render_fill->packet[ m_render_fill->count++ ] = m_packet;
+	if( m_render_fill->count == RENDER_BATCH_SIZE )
+	{
+		submit_render_batch();
+	}
+}
+
+void psxgpu_device::submit_render_batch()
+{
+	if( m_render_fill == nullptr )
+	{
+		return;
+	}
+
+	render_batch &batch = *m_render_fill;
+	batch.item = osd_work_item_queue( m_render_queue, render_batch_callback, &batch, 0 );
+	if( batch.item == nullptr )
+	{
+		render_batch_callback( &batch, 0 );
+	}
+
+	m_render_fill = nullptr;
+	m_render_next = ( m_render_next + 1 ) % RENDER_BATCHES;
+}
+
+void psxgpu_device::flush_render()
+{
+	if( m_render_queue == nullptr )
+	{
+		return;
+	}
+
+	for( unsigned n_batch = 0; n_batch < RENDER_BATCHES; n_batch++ )
+	{
+		render_batch &batch = m_render_batch[ ( m_render_next + n_batch ) % RENDER_BATCHES ];
+		if( batch.item != nullptr )
+		{
+			osd_work_item_wait( batch.item, osd_ticks_per_second() * 100 );
+			osd_work_item_release( batch.item );
+			batch.item = nullptr;
+		}
+	}
+
+	// the worker is idle now, so draw whatever hasn't been submitted on this thread
+	if( m_render_fill != nullptr )
+	{
+		render_batch_callback( m_render_fill, 0 );
+		m_render_fill = nullptr;
+	}
+}
+
+void psxgpu_device::discard_render()
+{
+	if( m_render_queue == nullptr )
+	{
+		return;
+	}
+
+	// queued batches can't be withdrawn, so tell the worker to skip them
+	// and stop the one in flight, then wait for it to drain
+	m_render_discard.store( true, std::memory_order_relaxed );
+	for( unsigned n_batch = 0; n_batch < RENDER_BATCHES; n_batch++ )
+	{
+		render_batch &batch = m_render_batch[ n_batch ];
+		if( batch.item != nullptr )
+		{
+			osd_work_item_wait( batch.item, osd_ticks_per_second() * 100 );
+			osd_work_item_release( batch.item );
+			batch.item = nullptr;
+		}
+		batch.count = 0;
+	}
+	m_render_discard.store( false, std::memory_order_relaxed );
+
+	m_render_fill = nullptr;
+}
+
+void *psxgpu_device::render_batch_callback( void *param, int threadid )
+{
+	render_batch &batch = *reinterpret_cast<render_batch *>( param );
+	for( unsigned n_packet = 0; n_packet < batch.count; n_packet++ )
+	{
+		if( batch.gpu->m_render_discard.load( std::memory_order_relaxed ) )
+		{
+			break;
+		}
+		batch.gpu->execute_command( batch.packet[ n_packet ] );
+	}
+	batch.count = 0;
+	return nullptr;
+}
+
 void psxgpu_device::dma_write( uint32_t *p_n_psxram, uint32_t n_address, int32_t n_size )
 {
 	gpu_write( &p_n_psxram[ n_address / 4 ], n_size );
+
+	// start drawing the list while the cpu carries on
+	submit_render_batch();
 }
 
 void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
@@ -2777,7 +3124,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: frame buffer rectangle %u,%u %u,%u\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 1 ] & 0xffff, m_packet.n_entry[ 1 ] >> 16, m_packet.n_entry[ 2 ] & 0xffff, m_packet.n_entry[ 2 ] >> 16 );
-				FrameBufferRectangleDraw();
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2792,7 +3139,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, machine().describe_context(), "%s: %02x: monochrome 3 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				FlatPolygon( 3 );
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2807,7 +3154,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: textured 3 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				FlatTexturedPolygon( 3 );
+				update_tpage_status( m_packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2822,7 +3170,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: monochrome 4 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				FlatPolygon( 4 );
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2837,7 +3185,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: textured 4 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				FlatTexturedPolygon( 4 );
+				update_tpage_status( m_packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2852,7 +3201,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud 3 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24 );
-				GouraudPolygon( 3 );
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2867,7 +3216,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud textured 3 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudTexturedPolygon( 3 );
+				update_tpage_status( m_packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2882,7 +3232,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud 4 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudPolygon( 4 );
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2897,7 +3247,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud textured 4 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudTexturedPolygon( 4 );
+				update_tpage_status( m_packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2912,7 +3263,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: monochrome line\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				MonochromeLine();
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2927,7 +3278,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: monochrome polyline\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				MonochromeLine();
+				queue_command();
 				if( ( m_packet.n_entry[ 3 ] & 0xf000f000 ) != 0x50005000 )
 				{
 					m_packet.n_entry[ 1 ] = m_packet.n_entry[ 2 ];
@@ -2951,7 +3302,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud line\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudLine();
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2967,7 +3318,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud polyline\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudLine();
+				queue_command();
 				if( ( m_packet.n_entry[ 4 ] & 0xf000f000 ) != 0x50005000 )
 				{
 					m_packet.n_entry[ 0 ] = ( m_packet.n_entry[ 0 ] & 0xff000000 ) | ( m_packet.n_entry[ 2 ] & 0x00ffffff );
@@ -2996,7 +3347,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					m_packet.n_entry[ 0 ] >> 24,
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					(int16_t)( m_packet.n_entry[ 2 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 2 ] >> 16 ) );
-				FlatRectangle();
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3015,7 +3366,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					m_packet.n_entry[ 3 ] & 0xffff, m_packet.n_entry[ 3 ] >> 16,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 2 ] );
-				FlatTexturedRectangle();
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3033,7 +3384,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					m_packet.n_entry[ 0 ] >> 24,
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					m_packet.n_entry[ 0 ] & 0xffffff );
-				Dot();
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3051,7 +3402,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					m_packet.n_entry[ 0 ] >> 24,
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					m_packet.n_entry[ 0 ] & 0xffffff );
-				TexturedDot();
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3068,7 +3419,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s; %02x: 16x16 rectangle %08x %08x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ] );
-				FlatRectangle8x8();
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3084,7 +3435,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: 8x8 sprite %08x %08x %08x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ] );
-				Sprite8x8();
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3101,7 +3452,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: 16x16 rectangle %08x %08x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ] );
-				FlatRectangle16x16();
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3117,7 +3468,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: 16x16 sprite %08x %08x %08x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ] );
-				Sprite16x16();
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3130,7 +3481,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: move image in frame buffer %08x %08x %08x %08x\n", machine().describe_context(),
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ], m_packet.n_entry[ 3 ]);
-				MoveImage();
+				queue_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3141,6 +3492,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			}
 			else
 			{
+				flush_render();
 				for( int n_pixel = 0; n_pixel < 2; n_pixel++ )
 				{
 					LOGMASKED(LOG_WRITE, "%s: send image to framebuffer ( pixel %u,%u = %u )\n",
@@ -3179,68 +3531,43 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: copy image from frame buffer\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
+				flush_render();
 				n_gpustatus |= ( 1L << 0x1b );
 			}
 			break;
 		case 0xe1:
 			LOGMASKED(LOG_WRITE, "%s: %02x: draw mode %06x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 				m_packet.n_entry[ 0 ] & 0xffffff );
-			decode_tpage( m_packet.n_entry[ 0 ] & 0xffffff );
+			update_tpage_status( m_packet.n_entry[ 0 ] & 0xffffff );
+			queue_command();
 			break;
 		case 0xe2:
-			n_twy = ( ( ( m_packet.n_entry[ 0 ] >> 15 ) & 0x1f ) << 3 );
-			n_twx = ( ( ( m_packet.n_entry[ 0 ] >> 10 ) & 0x1f ) << 3 );
-			n_twh = 255 - ( ( ( m_packet.n_entry[ 0 ] >> 5 ) & 0x1f ) << 3 );
-			n_tww = 255 - ( ( m_packet.n_entry[ 0 ] & 0x1f ) << 3 );
 			LOGMASKED(LOG_WRITE, "%s: %02x: texture window %u,%u %u,%u\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
-				n_twx, n_twy, n_tww, n_twh );
+				( ( m_packet.n_entry[ 0 ] >> 10 ) & 0x1f ) << 3, ( ( m_packet.n_entry[ 0 ] >> 15 ) & 0x1f ) << 3,
+				255 - ( ( m_packet.n_entry[ 0 ] & 0x1f ) << 3 ), 255 - ( ( ( m_packet.n_entry[ 0 ] >> 5 ) & 0x1f ) << 3 ) );
+			queue_command();
 			break;
 		case 0xe3:
-			n_drawarea_x1 = m_packet.n_entry[ 0 ] & 1023;
-			if( m_n_gputype == 2 )
-			{
-				n_drawarea_y1 = ( m_packet.n_entry[ 0 ] >> 10 ) & 1023;
-			}
-			else
-			{
-				n_drawarea_y1 = ( m_packet.n_entry[ 0 ] >> 12 ) & 1023;
-			}
-			LOGMASKED(LOG_WRITE, "%s: %02x: drawing area top left %d,%d\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
-				n_drawarea_x1, n_drawarea_y1 );
+			LOGMASKED(LOG_WRITE, "%s: %02x: drawing area top left %06x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
+				m_packet.n_entry[ 0 ] & 0xffffff );
+			queue_command();
 			break;
 		case 0xe4:
-			n_drawarea_x2 = m_packet.n_entry[ 0 ] & 1023;
-			if( m_n_gputype == 2 )
-			{
-				n_drawarea_y2 = ( m_packet.n_entry[ 0 ] >> 10 ) & 1023;
-			}
-			else
-			{
-				n_drawarea_y2 = ( m_packet.n_entry[ 0 ] >> 12 ) & 1023;
-			}
-			LOGMASKED(LOG_WRITE, "%s: %02x: drawing area bottom right %d,%d\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
-				n_drawarea_x2, n_drawarea_y2 );
+			LOGMASKED(LOG_WRITE, "%s: %02x: drawing area bottom right %06x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
+				m_packet.n_entry[ 0 ] & 0xffffff );
+			queue_command();
 			break;
 		case 0xe5:
-			n_drawoffset_x = util::sext( m_packet.n_entry[ 0 ] & 2047, 11 );
-			if( m_n_gputype == 2 )
-			{
-				n_drawoffset_y = util::sext( ( m_packet.n_entry[ 0 ] >> 11 ) & 2047, 11 );
-			}
-			else
-			{
-				n_drawoffset_y = util::sext( ( m_packet.n_entry[ 0 ] >> 12 ) & 2047, 11 );
-			}
-			LOGMASKED(LOG_WRITE, "%s: %02x: drawing offset %d,%d\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
-				n_drawoffset_x, n_drawoffset_y );
+			LOGMASKED(LOG_WRITE, "%s: %02x: drawing offset %06x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
+				m_packet.n_entry[ 0 ] & 0xffffff );
+			queue_command();
 			break;
 		case 0xe6:
-			m_draw_stp = BIT( data, 0 );
-			m_check_stp = BIT( data, 1 );
 			// TODO: confirm status bits on real type 1 gpu
 			n_gpustatus &= ~( 3L << 0xb );
 			n_gpustatus |= ( data & 0x03 ) << 0xb;
 			LOGMASKED(LOG_WRITE, "%s: mask setting %d\n", machine().describe_context(), m_packet.n_entry[ 0 ] & 3);
+			queue_command();
 			break;
 		default:
 #if defined( MAME_DEBUG )
@@ -3334,6 +3661,7 @@ void psxgpu_device::write(offs_t offset, uint32_t data, uint32_t mem_mask)
 			n_lightgun_y = 0;
 			break;
 		case 0x10:
+			flush_render();
 			switch( data & 0xff )
 			{
 			case 0x03:
@@ -3482,6 +3810,8 @@ void psxgpu_device::vblank(screen_device &screen, bool vblank_state)
 		DebugCheckKeys();
 #endif
 
+		submit_render_batch();
+
 		n_gpustatus ^= ( 1L << 31 );
 		m_vblank_handler(1);
 	}
@@ -3489,6 +3819,7 @@ void psxgpu_device::vblank(screen_device &screen, bool vblank_state)
 
 void psxgpu_device::gpu_reset()
 {
+	flush_render();
 	n_gpu_buffer_offset = 0;
 	n_gpustatus = 0x14802000;
 	n_drawarea_x1 = 0;
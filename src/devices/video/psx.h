@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #define PSXGPU_DEBUG_VIEWER ( 0 )
 
 DECLARE_DEVICE_TYPE(CXD8514Q,  cxd8514q_device)
@@ -49,6 +51,8 @@ protected:
 	psxgpu_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
 
 	virtual void device_start() override;
+	virtual void device_stop() override;
+	virtual void device_pre_save() override;
 	virtual void device_post_load() override;
 	virtual void device_reset() override;
 	virtual void device_config_complete() override;
@@ -196,24 +200,43 @@ private:
 		} TexturedDot;
 	};
 
+	// drawing commands are executed in order on a worker thread, a batch at a time
+	static constexpr unsigned RENDER_BATCH_SIZE = 1024;
+	static constexpr unsigned RENDER_BATCHES = 4;
+
+	struct render_batch
+	{
+		psxgpu_device *gpu;
+		osd_work_item *item;
+		unsigned count;
+		PACKET packet[ RENDER_BATCH_SIZE ];
+	};
+
 	void updatevisiblearea();
+	void update_tpage_status( uint32_t tpage );
 	void decode_tpage( uint32_t tpage );
-	void FlatPolygon( int n_points );
-	void FlatTexturedPolygon( int n_points );
-	void GouraudPolygon( int n_points );
-	void GouraudTexturedPolygon( int n_points );
-	void MonochromeLine();
-	void GouraudLine();
-	void FrameBufferRectangleDraw();
-	void FlatRectangle();
-	void FlatRectangle8x8();
-	void FlatRectangle16x16();
-	void FlatTexturedRectangle();
-	void Sprite8x8();
-	void Sprite16x16();
-	void Dot();
-	void TexturedDot();
-	void MoveImage();
+	void FlatPolygon( PACKET &packet, int n_points );
+	void FlatTexturedPolygon( PACKET &packet, int n_points );
+	void GouraudPolygon( PACKET &packet, int n_points );
+	void GouraudTexturedPolygon( PACKET &packet, int n_points );
+	void MonochromeLine( PACKET &packet );
+	void GouraudLine( PACKET &packet );
+	void FrameBufferRectangleDraw( PACKET &packet );
+	void FlatRectangle( PACKET &packet );
+	void FlatRectangle8x8( PACKET &packet );
+	void FlatRectangle16x16( PACKET &packet );
+	void FlatTexturedRectangle( PACKET &packet );
+	void Sprite8x8( PACKET &packet );
+	void Sprite16x16( PACKET &packet );
+	void Dot( PACKET &packet );
+	void TexturedDot( PACKET &packet );
+	void MoveImage( PACKET &packet );
+	void execute_command( PACKET &packet );
+	void queue_command();
+	void submit_render_batch();
+	void flush_render();
+	void discard_render();
+	static void *render_batch_callback( void *param, int threadid );
 	void psx_gpu_init( int n_gputype );
 	void gpu_reset();
 	void gpu_read( uint32_t *p_ram, int32_t n_size );
@@ -260,6 +283,12 @@ private:
 
 	PACKET m_packet;
 
+	osd_work_queue *m_render_queue;
+	std::unique_ptr<render_batch[]> m_render_batch;
+	render_batch *m_render_fill;
+	unsigned m_render_next;
+	std::atomic<bool> m_render_discard;
+
 	uint16_t *p_p_vram[ 1024 ];
 
 	uint16_t p_n_redshade[ MAX_LEVEL * MAX_SHADE ];
@@ -1241,6 +1241,7 @@ voodoo_renderer::voodoo_renderer(running_machine &machine, u16 tmu_config, const
 	m_tmu1_reg(tmu1_regs),
 	m_rgb565(rgb565),
 	m_fogdelta_mask(0xff),
+	m_generic_cached(0),
 	m_thread_stats(WORK_MAX_THREADS)
 {
 	// empty the hash table
@@ -1252,12 +1253,12 @@ voodoo_renderer::voodoo_renderer(running_machine &machine, u16 tmu_config, const
 
 	// add all predefined rasterizers
 	for (static_rasterizer_info const *info = s_predef_raster_table; info->params.generic() != 0xffffffff; info++)
-		add_rasterizer(info->params, info->mfp, false);
+		add_rasterizer(info->params, info->mfp, false, true);
 
 	// create entries for the generic rasterizers as well
 	rasterizer_params dummy_params;
 	for (int index = 0; index < std::size(m_generic_rasterizer); index++)
-		m_generic_rasterizer[index] = add_rasterizer(dummy_params, generic_rasterizer(index), true);
+		m_generic_rasterizer[index] = add_rasterizer(dummy_params, generic_rasterizer(index & 15, BIT(index, 4)), true, false);
 }
 
 
@@ -1347,11 +1348,20 @@ u32 voodoo_renderer::enqueue_triangle(poly_data &poly, vertex_t const *vert)
 	// determine the index of the generic rasterizer
 	if (info == nullptr)
 	{
-		// add a new one if we're logging usage
-		if (LOG_RASTERIZERS)
-			info = add_rasterizer(poly.raster, generic_rasterizer(poly.raster.generic()), true);
+		// opaque, unfogged triangles are common enough to deserve a generic
+		// variant without the alpha and fog stages
+		bool const plain = (poly.raster.alphamode().raw() | poly.raster.fogmode().raw()) == 0;
+
+		// remember the combination so later triangles find it at the head of
+		// its hash chain instead of walking the whole chain and missing again;
+		// always add a new one if we're logging usage
+		if (LOG_RASTERIZERS || m_generic_cached < MAX_CACHED_GENERIC)
+		{
+			info = add_rasterizer(poly.raster, generic_rasterizer(poly.raster.generic(), plain), true, true);
+			m_generic_cached++;
+		}
 		else
-			info = m_generic_rasterizer[poly.raster.generic()];
+			info = m_generic_rasterizer[(poly.raster.generic() & 15) | (plain ? 16 : 0)];
 	}
 
 	// set the info and render the triangle
@@ -2463,11 +2473,53 @@ void voodoo_renderer::rasterizer_fastfill(s32 y, const voodoo_renderer::extent_t
 //-------------------------------------------------
 //  generic_rasterizer - return a pointer to a
 //  generic rasterizer based on a texture enable
-//  mask
+//  mask; the plain variants hardwire alpha and
+//  fog modes of 0 so the per-pixel alpha test,
+//  alpha blend and fog stages compile away
 //-------------------------------------------------
 
-voodoo_renderer::rasterizer_mfp voodoo_renderer::generic_rasterizer(u8 texmask)
+voodoo_renderer::rasterizer_mfp voodoo_renderer::generic_rasterizer(u8 texmask, bool plain)
 {
+	if (plain)
+	{
+		switch (texmask & 15)
+		{
+		default:
+		case 0:
+			return &voodoo_renderer::rasterizer<0, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::NONE, reg_texture_mode::NONE>;
+		case 1:
+			return &voodoo_renderer::rasterizer<1, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::DECODE_LIVE, reg_texture_mode::NONE>;
+		case 2:
+			return &voodoo_renderer::rasterizer<2, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::NONE, reg_texture_mode::DECODE_LIVE>;
+		case 3:
+			return &voodoo_renderer::rasterizer<3, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE>;
+		case 4:
+			return &voodoo_renderer::rasterizer<4, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::NONE, reg_texture_mode::NONE>;
+		case 5:
+			return &voodoo_renderer::rasterizer<5, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::DECODE_LIVE, reg_texture_mode::NONE>;
+		case 6:
+			return &voodoo_renderer::rasterizer<6, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::NONE, reg_texture_mode::DECODE_LIVE>;
+		case 7:
+			return &voodoo_renderer::rasterizer<7, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE>;
+		case 8:
+			return &voodoo_renderer::rasterizer<8, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::NONE, reg_texture_mode::NONE>;
+		case 9:
+			return &voodoo_renderer::rasterizer<9, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::DECODE_LIVE, reg_texture_mode::NONE>;
+		case 10:
+			return &voodoo_renderer::rasterizer<10, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::NONE, reg_texture_mode::DECODE_LIVE>;
+		case 11:
+			return &voodoo_renderer::rasterizer<11, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE>;
+		case 12:
+			return &voodoo_renderer::rasterizer<12, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::NONE, reg_texture_mode::NONE>;
+		case 13:
+			return &voodoo_renderer::rasterizer<13, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::DECODE_LIVE, reg_texture_mode::NONE>;
+		case 14:
+			return &voodoo_renderer::rasterizer<14, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::NONE, reg_texture_mode::DECODE_LIVE>;
+		case 15:
+			return &voodoo_renderer::rasterizer<15, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, reg_texture_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE>;
+		}
+	}
+
 	switch (texmask & 15)
 	{
 	default:
@@ -2512,7 +2564,7 @@ voodoo_renderer::rasterizer_mfp voodoo_renderer::generic_rasterizer(u8 texmask)
 //  hash table
 //-------------------------------------------------
 
-rasterizer_info *voodoo_renderer::add_rasterizer(rasterizer_params const &params, rasterizer_mfp rasterizer, bool is_generic)
+rasterizer_info *voodoo_renderer::add_rasterizer(rasterizer_params const &params, rasterizer_mfp rasterizer, bool is_generic, bool hashed)
 {
 	rasterizer_info &info = m_rasterizer_list.emplace_back();
 
@@ -2528,7 +2580,7 @@ rasterizer_info *voodoo_renderer::add_rasterizer(rasterizer_params const &params
 
 	// hook us into the hash table
 	u32 hash = info.fullhash % RASTER_HASH_SIZE;
-	if (!is_generic || LOG_RASTERIZERS)
+	if (hashed)
 	{
 		info.next = m_raster_hash[hash];
 		m_raster_hash[hash] = &info;
@@ -26,7 +26,7 @@ struct poly_data;
 class dither_helper;
 
 // base class for our renderer
-using voodoo_poly_manager = poly_manager<float, poly_data, 0, POLY_FLAG_NO_CLIPPING>;
+using voodoo_poly_manager = poly_manager<float, poly_data, 0, POLY_FLAG_NO_CLIPPING | POLY_FLAG_NO_TILING>;
 
 
 
@@ -495,6 +495,7 @@ struct thread_stats_block
 class voodoo_renderer : public voodoo_poly_manager
 {
 	static constexpr u32 RASTER_HASH_SIZE = 97; // size of the rasterizer hash table
+	static constexpr u32 MAX_CACHED_GENERIC = 256; // maximum number of remembered generic fallbacks
 
 public:
 	using rasterizer_mfp = void (voodoo_renderer::*)(int32_t, const extent_t &, const poly_data &, int);
@@ -588,8 +589,8 @@ private:
 	void rasterizer_fastfill(s32 scanline, const voodoo::voodoo_renderer::extent_t &extent, const voodoo::poly_data &extradata, int threadid);
 
 	// helpers
-	static rasterizer_mfp generic_rasterizer(u8 texmask);
-	voodoo::rasterizer_info *add_rasterizer(voodoo::rasterizer_params const &params, rasterizer_mfp rasterizer, bool is_generic);
+	static rasterizer_mfp generic_rasterizer(u8 texmask, bool plain);
+	voodoo::rasterizer_info *add_rasterizer(voodoo::rasterizer_params const &params, rasterizer_mfp rasterizer, bool is_generic, bool hashed);
 
 	// internal state
 	u8 m_bilinear_mask;         // mask for bilinear resolution (0xf0 for V1, 0xff for V2)
@@ -606,7 +607,8 @@ private:
 	poly_array<voodoo::rasterizer_texture, 2> m_textures;
 	poly_array<voodoo::rasterizer_palette, 8> m_palettes;
 	voodoo::rasterizer_info *m_raster_hash[RASTER_HASH_SIZE]; // hash table of rasterizers
-	voodoo::rasterizer_info *m_generic_rasterizer[16];
+	voodoo::rasterizer_info *m_generic_rasterizer[32]; // generic rasterizers by texture mask, plus 16 for plain
+	u32 m_generic_cached;       // number of generic fallbacks added to the hash table
 	std::list<voodoo::rasterizer_info> m_rasterizer_list;
 	std::vector<thread_stats_block> m_thread_stats;
 };
@@ -14,6 +14,14 @@
 #define VERBOSE 0
 
 
+//**************************************************************************
+//  GLOBAL VARIABLES
+//**************************************************************************
+
+thread_local bool device_palette_interface::s_reader_thread = false;
+
+
+
 //**************************************************************************
 //  DEVICE INTERFACE MANAGEMENT
 //**************************************************************************
@@ -330,6 +338,20 @@ void device_palette_interface::set_shadow_dRGB32(int mode, int dr, int dg, int d
 //  INTERNAL FUNCTIONS
 //**************************************************************************
 
+//-------------------------------------------------
+//  apply_pending_changes - bring the pens up to
+//  date for a reader on the main thread, so a pen
+//  reads back the color just set
+//-------------------------------------------------
+
+void device_palette_interface::apply_pending_changes() const
+{
+	// the video manager waits for any pipelined update still reading pens
+	if (!s_reader_thread)
+		device().machine().video().apply_palette_changes();
+}
+
+
 //-------------------------------------------------
 //  allocate_palette - allocate and configure the
 //  palette object itself
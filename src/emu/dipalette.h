@@ -39,15 +39,26 @@ class device_palette_interface : public device_interface
 {
 	friend class screen_device;
 
+	static thread_local bool s_reader_thread;
+
 	static constexpr int MAX_SHADOW_PRESETS = 4;
 
 public:
+	// marks the calling thread as drawing a banded or pipelined screen update;
+	// such threads only read pens, as changes were applied before they started
+	class reader_thread_scope
+	{
+	public:
+		reader_thread_scope() { s_reader_thread = true; }
+		~reader_thread_scope() { s_reader_thread = false; }
+	};
+
 	// getters
 	u32 entries() const noexcept { return palette_entries(); }
 	u32 indirect_entries() const noexcept { return palette_indirect_entries(); }
 	palette_t *palette() const { return m_palette; }
-	const pen_t &pen(int index) const { return m_pens[index]; }
-	const pen_t *pens() const { return m_pens; }
+	const pen_t &pen(int index) const { if (m_palette->pending()) apply_pending_changes(); return m_pens[index]; }
+	const pen_t *pens() const { if (m_palette->pending()) apply_pending_changes(); return m_pens; }
 	pen_t *shadow_table() const { return m_shadow_table; }
 	rgb_t pen_color(pen_t pen) const { return m_palette->entry_color(pen); }
 	double pen_contrast(pen_t pen) const { return m_palette->entry_contrast(pen); }
@@ -99,6 +110,7 @@ protected:
 
 private:
 	// internal helpers
+	void apply_pending_changes() const;
 	void allocate_palette(u32 numentries);
 	void allocate_color_tables();
 	void allocate_shadow_tables();
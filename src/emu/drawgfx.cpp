@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "drawgfxt.ipp"
+#include "video/gfxspan.h"
 
 
 /***************************************************************************
@@ -395,7 +396,8 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, nullptr,
+			[trans_pen, color](u16 *destp, u8 *, const u8 *srcp, s32 count, bool flip) { emu::gfxspan::transpen_rebase(destp, srcp, count, flip, color, trans_pen); });
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -422,7 +424,8 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, nullptr,
+			[trans_pen, paldata](u32 *destp, u8 *, const u8 *srcp, s32 count, bool flip) { emu::gfxspan::transpen_remap(destp, srcp, count, flip, paldata, trans_pen); });
 }
 
 
@@ -936,7 +939,8 @@ void gfx_element::prio_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, &priority,
+			[pmask, trans_pen, color](u16 *destp, u8 *pri, const u8 *srcp, s32 count, bool flip) { emu::gfxspan::prio_transpen_rebase(destp, pri, srcp, count, flip, color, pmask, trans_pen); });
 }
 
 void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -966,7 +970,8 @@ void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, paldata](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, &priority,
+			[pmask, trans_pen, paldata](u32 *destp, u8 *pri, const u8 *srcp, s32 count, bool flip) { emu::gfxspan::prio_transpen_remap(destp, pri, srcp, count, flip, paldata, pmask, trans_pen); });
 }
 
 
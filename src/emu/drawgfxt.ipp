@@ -698,6 +698,93 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 
 
 
+/***************************************************************************
+    SPAN DRAWGFX CORE
+***************************************************************************/
+
+/*
+    Input parameters are as for the basic core, except that 'priority'
+    is a pointer that may be null and 'span_op' is called once per
+    clipped row as span_op(destptr, priptr, srcptr, count, flip).  When
+    flip is true the span reads source pixels backwards from srcptr.
+    priptr is null when no priority bitmap is supplied.
+*/
+
+template <typename BitmapType, typename FunctionClass>
+inline void gfx_element::drawgfx_span_core(BitmapType &dest, const rectangle &cliprect, u32 code, int flipx, int flipy, s32 destx, s32 desty, bitmap_ind8 *priority, FunctionClass span_op)
+{
+	auto profile = g_profiler.start(PROFILER_DRAWGFX);
+	do {
+		assert(dest.valid());
+		assert(!priority || priority->valid());
+		assert(dest.cliprect().contains(cliprect));
+		assert(code < elements());
+
+		// ignore empty/invalid cliprects
+		if (cliprect.empty())
+			break;
+
+		// compute final pixel in X and exit if we are entirely clipped
+		s32 destendx = destx + width() - 1;
+		if (destx > cliprect.right() || destendx < cliprect.left())
+			break;
+
+		// apply left clip
+		s32 srcx = 0;
+		if (destx < cliprect.left())
+		{
+			srcx = cliprect.left() - destx;
+			destx = cliprect.left();
+		}
+
+		// apply right clip
+		if (destendx > cliprect.right())
+			destendx = cliprect.right();
+
+		// compute final pixel in Y and exit if we are entirely clipped
+		s32 destendy = desty + height() - 1;
+		if (desty > cliprect.bottom() || destendy < cliprect.top())
+			break;
+
+		// apply top clip
+		s32 srcy = 0;
+		if (desty < cliprect.top())
+		{
+			srcy = cliprect.top() - desty;
+			desty = cliprect.top();
+		}
+
+		// apply bottom clip
+		if (destendy > cliprect.bottom())
+			destendy = cliprect.bottom();
+
+		// apply X flipping
+		if (flipx)
+			srcx = width() - 1 - srcx;
+
+		// apply Y flipping
+		s32 dy = rowbytes();
+		if (flipy)
+		{
+			srcy = height() - 1 - srcy;
+			dy = -dy;
+		}
+
+		// fetch the source data and point to the first source pixel of the row
+		const u8 *srcdata = get_data(code) + srcy * rowbytes() + srcx;
+		s32 const count = destendx + 1 - destx;
+
+		// iterate over rows in Y
+		for (s32 cury = desty; cury <= destendy; cury++)
+		{
+			u8 *const priptr = priority ? &priority->pix(cury, destx) : nullptr;
+			span_op(&dest.pix(cury, destx), priptr, srcdata, count, flipx != 0);
+			srcdata += dy;
+		}
+	} while (0);
+}
+
+
 /***************************************************************************
     BASIC DRAWGFXZOOM CORE
 ***************************************************************************/
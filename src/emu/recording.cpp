@@ -17,6 +17,8 @@
 #include "aviio.h"
 #include "png.h"
 
+#include <algorithm>
+
 
 namespace
 {
@@ -28,11 +30,13 @@ namespace
 		{
 		}
 
+		~avi_movie_recording() { flush(); }
+
 		bool initialize(running_machine &machine, std::unique_ptr<emu_file> &&file, int32_t width, int32_t height);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
 
 	private:
 		avi_file::ptr m_avi_file; // handle to the open movie file
@@ -46,14 +50,15 @@ namespace
 		~mng_movie_recording();
 
 		bool initialize(std::unique_ptr<emu_file> &&file, bitmap_t &snap_bitmap);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
 
 	private:
 		std::unique_ptr<emu_file> m_mng_file; // handle to the open movie file
 		std::map<std::string, std::string> m_info_fields;
+		osd_work_queue *m_deflate_queue; // queue for compressing large frames in parallel
 	};
 };
 
@@ -71,7 +76,14 @@ movie_recording::movie_recording(screen_device *screen)
 	, m_frame_period(attotime::zero)
 	, m_next_frame_time(attotime::zero)
 	, m_frame(0)
+	, m_written_frame(0)
+	, m_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO))
+	, m_next_job(0)
+	, m_stalls(0)
+	, m_failed(false)
 {
+	for (pending_job &job : m_jobs)
+		job.owner = this;
 }
 
 
@@ -81,6 +93,112 @@ movie_recording::movie_recording(screen_device *screen)
 
 movie_recording::~movie_recording()
 {
+	flush();
+	if (m_queue)
+		osd_work_queue_free(m_queue);
+}
+
+
+//-------------------------------------------------
+//  movie_recording::flush - wait for every queued
+//  frame and sound block to be written
+//-------------------------------------------------
+
+void movie_recording::flush()
+{
+	for (pending_job &job : m_jobs)
+	{
+		if (job.item)
+		{
+			osd_work_item_wait(job.item, osd_ticks_per_second() * 100);
+			osd_work_item_release(job.item);
+			job.item = nullptr;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  movie_recording::pending_jobs - number of
+//  frames and sound blocks not yet written
+//-------------------------------------------------
+
+int movie_recording::pending_jobs() const
+{
+	return m_queue ? osd_work_queue_items(m_queue) : 0;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::claim_job - get the next ring
+//  slot, waiting for the writer if it is still
+//  busy with it
+//-------------------------------------------------
+
+movie_recording::pending_job &movie_recording::claim_job()
+{
+	pending_job &job = m_jobs[m_next_job];
+	m_next_job = (m_next_job + 1) % MAX_PENDING_JOBS;
+	if (job.item)
+	{
+		if (!osd_work_item_wait(job.item, 0))
+		{
+			m_stalls++;
+			osd_work_item_wait(job.item, osd_ticks_per_second() * 100);
+		}
+		osd_work_item_release(job.item);
+		job.item = nullptr;
+	}
+	return job;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::submit_job - hand a filled
+//  slot to the writer thread
+//-------------------------------------------------
+
+void movie_recording::submit_job(pending_job &job)
+{
+	if (m_queue)
+		job.item = osd_work_item_queue(m_queue, write_job, &job, 0);
+	if (!job.item)
+		write_job(&job, 0);
+}
+
+
+//-------------------------------------------------
+//  movie_recording::write_job - encode and write
+//  a job on the writer thread
+//-------------------------------------------------
+
+void *movie_recording::write_job(void *param, int threadid)
+{
+	pending_job &job = *reinterpret_cast<pending_job *>(param);
+	movie_recording &owner = *job.owner;
+
+	// once something has failed, drop everything still queued
+	if (owner.m_failed.load(std::memory_order_relaxed))
+		return nullptr;
+
+	bool success = true;
+	if (job.frames)
+	{
+		rgb_t const *const palette = job.palette.empty() ? nullptr : &job.palette[0];
+		for (int frame = 0; success && (frame < job.frames); frame++)
+		{
+			owner.m_written_frame = job.first_frame + frame;
+			success = owner.append_single_video_frame(job.bitmap, palette, job.palette.size());
+		}
+	}
+	else
+	{
+		success = owner.append_sound_samples(&job.sound[0], job.sound.size() / 2);
+	}
+
+	if (!success)
+		owner.m_failed.store(true, std::memory_order_relaxed);
+	return nullptr;
 }
 
 
@@ -90,22 +208,62 @@ movie_recording::~movie_recording()
 
 bool movie_recording::append_video_frame(bitmap_rgb32 &bitmap, attotime curtime)
 {
-	// identify the palette
-	bool has_palette = screen() && screen()->has_palette();
-	const rgb_t *palette = has_palette ? screen()->palette().palette()->entry_list_adjusted() : nullptr;
-	int palette_entries = has_palette ? screen()->palette().entries() : 0;
+	if (m_failed.load(std::memory_order_relaxed))
+		return false;
 
-	// keep appending frames until we're at curtime
+	// count how many movie frames this bitmap covers
+	int frames = 0;
 	while (next_frame_time() <= curtime)
 	{
-		// append this bitmap as a single frame
-		if (!append_single_video_frame(bitmap, palette, palette_entries))
-			return false;
-		m_frame++;
-
-		// advance time
+		frames++;
 		set_next_frame_time(next_frame_time() + frame_period());
 	}
+	if (!frames)
+		return true;
+
+	// copy the bitmap and palette; conversion and encoding happen on the writer thread
+	pending_job &job = claim_job();
+	if ((job.bitmap.width() != bitmap.width()) || (job.bitmap.height() != bitmap.height()))
+		job.bitmap.allocate(bitmap.width(), bitmap.height());
+	for (int y = 0; y < bitmap.height(); y++)
+		std::copy_n(&bitmap.pix(y), bitmap.width(), &job.bitmap.pix(y));
+
+	bool const has_palette = screen() && screen()->has_palette();
+	if (has_palette)
+	{
+		screen()->palette().palette()->update();
+		rgb_t const *const palette = screen()->palette().palette()->entry_list_adjusted();
+		job.palette.assign(palette, palette + screen()->palette().entries());
+	}
+	else
+	{
+		job.palette.clear();
+	}
+
+	job.first_frame = m_frame;
+	job.frames = frames;
+	m_frame += frames;
+	submit_job(job);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::add_sound_to_recording
+//-------------------------------------------------
+
+bool movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+{
+	if (m_failed.load(std::memory_order_relaxed))
+		return false;
+	if (numsamples <= 0)
+		return true;
+
+	// samples are interleaved stereo
+	pending_job &job = claim_job();
+	job.frames = 0;
+	job.sound.assign(sound, sound + numsamples * 2);
+	submit_job(job);
 	return true;
 }
 
@@ -217,13 +375,11 @@ bool avi_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 
 
 //-------------------------------------------------
-//  avi_movie_recording::append_video_frame
+//  avi_movie_recording::append_sound_samples
 //-------------------------------------------------
 
-bool avi_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool avi_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
 {
-	auto profile = g_profiler.start(PROFILER_MOVIE_REC);
-
 	// write the next frame
 	avi_file::error avierr = m_avi_file->append_sound_samples(0, sound + 0, numsamples, 1);
 	if (avierr == avi_file::error::NONE)
@@ -240,6 +396,7 @@ bool avi_movie_recording::add_sound_to_recording(const s16 *sound, int numsample
 mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::string, std::string> &&info_fields)
 	: movie_recording(screen)
 	, m_info_fields(std::move(info_fields))
+	, m_deflate_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI))
 {
 }
 
@@ -250,8 +407,11 @@ mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::st
 
 mng_movie_recording::~mng_movie_recording()
 {
+	flush();
 	if (m_mng_file)
 		util::mng_capture_stop(*m_mng_file);
+	if (m_deflate_queue)
+		osd_work_queue_free(m_deflate_queue);
 }
 
 
@@ -288,16 +448,20 @@ bool mng_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 			pnginfo.add_text(ent.first, ent.second);
 	}
 
-	std::error_condition const error = util::mng_capture_frame(*m_mng_file, pnginfo, bitmap, palette_entries, palette);
+	// favour speed over size; frames keep coming at the emulated frame rate
+	util::png_write_options options;
+	options.level = 1;
+	options.queue = m_deflate_queue;
+	std::error_condition const error = util::mng_capture_frame(*m_mng_file, pnginfo, bitmap, palette_entries, palette, options);
 	return !error;
 }
 
 
 //-------------------------------------------------
-//  mng_movie_recording::add_sound_to_recording
+//  mng_movie_recording::append_sound_samples
 //-------------------------------------------------
 
-bool mng_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool mng_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
 {
 	// not supported; do nothing
 	return true;
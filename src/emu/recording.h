@@ -17,7 +17,9 @@
 #ifndef MAME_EMU_RECORDING_H
 #define MAME_EMU_RECORDING_H
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include "attotime.h"
 #include "palette.h"
@@ -51,12 +53,12 @@ public:
 	attotime frame_period()                 { return m_frame_period; }
 	void set_next_frame_time(attotime time) { m_next_frame_time = time; }
 	attotime next_frame_time() const        { return m_next_frame_time; }
+	int pending_jobs() const;
+	u32 stalls() const                      { return m_stalls; }
 
 	// methods
 	bool append_video_frame(bitmap_rgb32 &bitmap, attotime curtime);
-
-	// virtuals
-	virtual bool add_sound_to_recording(const s16 *sound, int numsamples) = 0;
+	bool add_sound_to_recording(const s16 *sound, int numsamples);
 
 	// statics
 	static movie_recording::ptr create(running_machine &machine, screen_device *screen, format fmt, std::unique_ptr<emu_file> &&file, bitmap_rgb32 &snap_bitmap);
@@ -68,18 +70,48 @@ protected:
 	movie_recording(const movie_recording &) = delete;
 	movie_recording(movie_recording &&) = delete;
 
-	// virtuals
+	// virtuals; these are called on the writer thread, in submission order
 	virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) = 0;
+	virtual bool append_sound_samples(const s16 *sound, int numsamples) = 0;
 
 	// accessors
-	int current_frame() const { return m_frame; }
+	int current_frame() const { return m_written_frame; }
 	void set_frame_period(attotime time) { m_frame_period = time; }
 
+	// wait for all queued work; derived destructors must call this before closing their files
+	void flush();
+
 private:
+	// a frame or block of sound waiting to be written
+	struct pending_job
+	{
+		movie_recording *   owner = nullptr;
+		osd_work_item *     item = nullptr;
+		int                 first_frame = 0;        // movie frame number of the first copy
+		int                 frames = 0;             // copies of the bitmap to append; 0 for sound
+		bitmap_rgb32        bitmap;
+		std::vector<rgb_t>  palette;
+		std::vector<s16>    sound;
+	};
+
+	// maximum frames and sound blocks in flight before the emulation thread waits
+	static constexpr int MAX_PENDING_JOBS = 8;
+
+	pending_job &claim_job();
+	void submit_job(pending_job &job);
+	static void *write_job(void *param, int threadid);
+
 	screen_device * m_screen;               // screen associated with this movie (can be nullptr)
 	attotime        m_frame_period;         // duration of movie frame
 	attotime        m_next_frame_time;      // time of next frame
 	int             m_frame;                // current movie frame number
+	int             m_written_frame;        // frame number seen by the writer thread
+
+	osd_work_queue *    m_queue;            // single writer thread, so jobs complete in order
+	pending_job         m_jobs[MAX_PENDING_JOBS];
+	int                 m_next_job;         // next ring slot to fill
+	u32                 m_stalls;           // times the emulation thread had to wait for the writer
+	std::atomic<bool>   m_failed;           // set by the writer thread on an encoding or I/O error
 };
 
 
@@ -99,6 +99,47 @@ struct render_target::object_transform
 };
 
 
+// an element_cache_entry holds the primitive last built for a layout element item,
+// along with everything it was built from, so it can be reused until something changes
+struct render_target::element_cache_entry
+{
+	bool matches(layout_view_item const &curitem, render_texture const &curtexture, object_transform const &curxform, render_bounds const &curbounds, int maxwidth, int maxheight) const
+	{
+		return (item == &curitem) && (texture == &curtexture) &&
+				(texseq == curtexture.m_curseq) && (texid == curtexture.m_id) && (curtexture.m_old_id == ~0ULL) &&
+				(xform.xoffs == curxform.xoffs) && (xform.yoffs == curxform.yoffs) &&
+				(xform.xscale == curxform.xscale) && (xform.yscale == curxform.yscale) &&
+				same_color(xform.color, curxform.color) && (xform.orientation == curxform.orientation) &&
+				(blendmode == curitem.blend_mode()) &&
+				(scroll_wrap_x == curitem.scroll_wrap_x()) && (scroll_wrap_y == curitem.scroll_wrap_y()) &&
+				(scroll_size_x == curitem.scroll_size_x()) && (scroll_size_y == curitem.scroll_size_y()) &&
+				(scroll_pos_x == curitem.scroll_pos_x()) && (scroll_pos_y == curitem.scroll_pos_y()) &&
+				same_bounds(bounds, curbounds) && (maxtexwidth == maxwidth) && (maxtexheight == maxheight);
+	}
+
+	static bool same_color(render_color const &a, render_color const &b) { return (a.a == b.a) && (a.r == b.r) && (a.g == b.g) && (a.b == b.b); }
+	static bool same_bounds(render_bounds const &a, render_bounds const &b) { return (a.x0 == b.x0) && (a.y0 == b.y0) && (a.x1 == b.x1) && (a.y1 == b.y1); }
+
+	layout_view_item const *item = nullptr;     // item the primitive was built for
+	render_texture const *  texture = nullptr;  // state texture it was built from
+	u32                     texseq = 0;         // texture sequence number at the time
+	u64                     texid = 0;          // texture unique id at the time
+	object_transform        xform;              // item transform
+	int                     blendmode = 0;      // item blend mode
+	bool                    scroll_wrap_x = false, scroll_wrap_y = false;
+	float                   scroll_size_x = 0.0f, scroll_size_y = 0.0f;
+	float                   scroll_pos_x = 0.0f, scroll_pos_y = 0.0f;
+	render_bounds           bounds;             // target bounds
+	int                     maxtexwidth = 0;    // maximum texture size
+	int                     maxtexheight = 0;
+	render_primitive        prim;               // the primitive built
+	void *                  refptr = nullptr;   // bitmap the primitive references
+	s32                     texwidth = 0;       // size the texture was scaled to
+	s32                     texheight = 0;
+	bool                    clipped = false;    // true if the primitive was clipped out entirely
+};
+
+
 
 //**************************************************************************
 //  GLOBAL VARIABLES
@@ -298,10 +339,13 @@ render_texture::render_texture()
 		m_old_id(~0ULL),
 		m_scaler(nullptr),
 		m_param(nullptr),
-		m_curseq(0)
+		m_curseq(0),
+		m_dirty_seq(0),
+		m_dirty_top(0),
+		m_dirty_bottom(-1),
+		m_lookup_seq(0)
 {
 	m_sbounds.set(0, -1, 0, -1);
-	memset(m_scaled, 0, sizeof(m_scaled));
 }
 
 
@@ -341,12 +385,8 @@ void render_texture::reset(render_manager &manager, texture_scaler_func scaler,
 void render_texture::release()
 {
 	// free all scaled versions
-	for (auto &elem : m_scaled)
-	{
-		m_manager->invalidate_all(elem.bitmap.get());
-		elem.bitmap.reset();
-		elem.seqid = 0;
-	}
+	if (m_manager && m_scaler)
+		m_manager->free_scaled(*this);
 
 	// invalidate references to the original bitmap as well
 	m_manager->invalidate_all(m_bitmap);
@@ -354,6 +394,8 @@ void render_texture::release()
 	m_sbounds.set(0, -1, 0, -1);
 	m_format = TEXFORMAT_ARGB32;
 	m_curseq = 0;
+	mark_all_dirty();
+	m_lookup_seq = 0;
 }
 
 
@@ -362,9 +404,25 @@ void render_texture::release()
 //-------------------------------------------------
 
 void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, texture_format format)
+{
+	set_bitmap(bitmap, sbounds, format, sbounds.top(), sbounds.bottom());
+}
+
+
+//-------------------------------------------------
+//  set_bitmap - set a new source bitmap, noting
+//  that only rows dirtytop to dirtybottom have
+//  changed if it is the same bitmap as before
+//-------------------------------------------------
+
+void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, texture_format format, s32 dirtytop, s32 dirtybottom)
 {
 	assert(bitmap.cliprect().contains(sbounds));
 
+	// a partial update only makes sense against the same source; anything else is a full one
+	const bool partial = (&bitmap == m_bitmap) && (sbounds == m_sbounds) && (format == m_format) && !m_scaler &&
+			((dirtytop > sbounds.top()) || (dirtybottom < sbounds.bottom()));
+
 	// ensure we have a valid palette for palettized modes
 	if (format == TEXFORMAT_PALETTE16)
 		assert(bitmap.palette() != nullptr);
@@ -377,16 +435,22 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	m_bitmap = &bitmap;
 	m_sbounds = sbounds;
 	m_format = format;
-	m_curseq++;
-
-	// invalidate all scaled versions
-	for (auto & elem : m_scaled)
+	if (partial)
+	{
+		m_dirty_seq = m_curseq;
+		m_dirty_top = std::max(dirtytop, sbounds.top()) - sbounds.top();
+		m_dirty_bottom = std::min(dirtybottom, sbounds.bottom()) - sbounds.top();
+		m_curseq++;
+	}
+	else
 	{
-		if (elem.bitmap)
-			m_manager->invalidate_all(elem.bitmap.get());
-		elem.bitmap.reset();
-		elem.seqid = 0;
+		m_curseq++;
+		mark_all_dirty();
 	}
+
+	// invalidate all scaled versions
+	if (m_scaler)
+		m_manager->free_scaled(*this);
 }
 
 
@@ -405,9 +469,10 @@ void render_texture::hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const
 
 //-------------------------------------------------
 //  get_scaled - get a scaled bitmap (if we can)
+//  and return the bitmap the list now references
 //-------------------------------------------------
 
-void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags)
+void *render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags)
 {
 	// source width/height come from the source bounds
 	int swidth = m_sbounds.width();
@@ -425,7 +490,7 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 	// are we scaler-free? if so, just return the source bitmap
 	if (m_scaler == nullptr || (m_bitmap != nullptr && swidth == dwidth && sheight == dheight))
 	{
-		if (m_bitmap == nullptr) return;
+		if (m_bitmap == nullptr) return nullptr;
 
 		// add a reference and set up the source bitmap
 		primlist.add_reference(m_bitmap);
@@ -436,6 +501,10 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		texinfo.height = sheight;
 		// palette will be set later
 		texinfo.seqid = m_curseq;
+		texinfo.dirty_seqid = m_dirty_seq;
+		texinfo.dirty_top = m_dirty_top;
+		texinfo.dirty_bottom = m_dirty_bottom;
+		return m_bitmap;
 	}
 	else
 	{
@@ -443,54 +512,27 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		bitmap_argb32 dummy;
 		bitmap_argb32 &srcbitmap = (m_bitmap != nullptr) ? downcast<bitmap_argb32 &>(*m_bitmap) : dummy;
 
-		// is it a size we already have?
-		scaled_texture *scaled = nullptr;
-		int scalenum;
-		for (scalenum = 0; scalenum < std::size(m_scaled); scalenum++)
+		// is it a size we already have? if not, make one and let the scaler do the work
+		bitmap_argb32 *scaled = m_manager->find_scaled(*this, dwidth, dheight);
+		if (!scaled)
 		{
-			scaled = &m_scaled[scalenum];
-
-			// we need a non-NULL bitmap with matching dest size
-			if (scaled->bitmap != nullptr && dwidth == scaled->bitmap->width() && dheight == scaled->bitmap->height())
-				break;
-		}
-
-		// did we get one?
-		if (scalenum == std::size(m_scaled))
-		{
-			int lowest = -1;
-
-			// didn't find one -- take the entry with the lowest seqnum
-			for (scalenum = 0; scalenum < std::size(m_scaled); scalenum++)
-				if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !primlist.has_reference(m_scaled[scalenum].bitmap.get()))
-					lowest = scalenum;
-			if (-1 == lowest)
-				throw emu_fatalerror("render_texture::get_scaled: Too many live texture instances!");
-
-			// throw out any existing entries
-			scaled = &m_scaled[lowest];
-			if (scaled->bitmap)
-			{
-				m_manager->invalidate_all(scaled->bitmap.get());
-				scaled->bitmap.reset();
-			}
-
-			// allocate a new bitmap
-			scaled->bitmap = std::make_unique<bitmap_argb32>(dwidth, dheight);
-			scaled->seqid = ++m_curseq;
-
-			// let the scaler do the work
-			(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
+			scaled = &m_manager->alloc_scaled(*this, dwidth, dheight, primlist);
+			++m_curseq;
+			(*m_scaler)(*scaled, srcbitmap, m_sbounds, m_param);
 		}
 
 		// finally fill out the new info
-		primlist.add_reference(scaled->bitmap.get());
-		texinfo.base = &scaled->bitmap->pix(0);
-		texinfo.rowpixels = scaled->bitmap->rowpixels();
+		primlist.add_reference(scaled);
+		texinfo.base = &scaled->pix(0);
+		texinfo.rowpixels = scaled->rowpixels();
 		texinfo.width = dwidth;
 		texinfo.height = dheight;
 		// palette will be set later
 		texinfo.seqid = m_curseq;
+		texinfo.dirty_seqid = m_curseq;
+		texinfo.dirty_top = 0;
+		texinfo.dirty_bottom = dheight - 1;
+		return scaled;
 	}
 }
 
@@ -502,6 +544,15 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 
 const rgb_t *render_texture::get_adjusted_palette(render_container &container, u32 &out_length)
 {
+	// rows converted with an older lookup table are stale, so the next copy has to be a full one
+	// (scaled textures are always copied in full anyway)
+	if (!m_scaler && (m_lookup_seq != container.m_lookup_seq))
+	{
+		m_lookup_seq = container.m_lookup_seq;
+		m_curseq++;
+		mark_all_dirty();
+	}
+
 	// override the palette with our adjusted palette
 	switch (m_format)
 	{
@@ -529,6 +580,20 @@ const rgb_t *render_texture::get_adjusted_palette(render_container &container, u
 }
 
 
+//-------------------------------------------------
+//  mark_all_dirty - make the next copy of the
+//  texture a full one
+//-------------------------------------------------
+
+void render_texture::mark_all_dirty()
+{
+	// a copy can never be cached at the current sequence number without already being up to date
+	m_dirty_seq = m_curseq;
+	m_dirty_top = 0;
+	m_dirty_bottom = m_sbounds.height() - 1;
+}
+
+
 
 //**************************************************************************
 //  RENDER CONTAINER
@@ -543,6 +608,7 @@ render_container::render_container(render_manager &manager, screen_device *scree
 	, m_screen(screen)
 	, m_overlaybitmap(nullptr)
 	, m_overlaytexture(nullptr)
+	, m_lookup_seq(0)
 {
 	// make sure it is empty
 	empty();
@@ -649,6 +715,8 @@ void render_container::add_char(float x0, float y0, float height, float aspect,
 	newitem.m_texture = texture;
 	newitem.m_flags = PRIMFLAG_TEXORIENT(ROT0) | PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA) | PRIMFLAG_PACKABLE;
 	newitem.m_internal = INTERNAL_FLAG_CHAR;
+	newitem.m_font = &font;
+	newitem.m_char = ch;
 }
 
 
@@ -762,6 +830,8 @@ render_container::item &render_container::add_generic(u8 type, float x0, float y
 	newitem->m_internal = 0;
 	newitem->m_width = 0;
 	newitem->m_texture = nullptr;
+	newitem->m_font = nullptr;
+	newitem->m_char = 0;
 
 	// add the item to the container
 	return m_itemlist.append(*newitem);
@@ -775,6 +845,9 @@ render_container::item &render_container::add_generic(u8 type, float x0, float y
 
 void render_container::recompute_lookups()
 {
+	// textures compare this to know their converted copies are stale
+	m_lookup_seq++;
+
 	// recompute the 256 entry lookup table
 	for (int i = 0; i < 0x100; i++)
 	{
@@ -789,6 +862,7 @@ void render_container::recompute_lookups()
 	if (m_palclient != nullptr)
 	{
 		palette_t &palette = m_palclient->palette();
+		palette.update();
 		const rgb_t *adjusted_palette = palette.entry_list_adjusted();
 		int colors = palette.max_index();
 
@@ -820,13 +894,15 @@ void render_container::update_palette()
 	if (m_palclient == nullptr)
 		return;
 
-	// get the dirty list
+	// get the dirty list, after applying changes no update can be reading any more
+	m_manager.machine().video().apply_palette_changes();
 	u32 mindirty, maxdirty;
 	const u32 *dirty = m_palclient->dirty_list(mindirty, maxdirty);
 
 	// iterate over dirty items and update them
 	if (dirty != nullptr)
 	{
+		m_lookup_seq++;
 		palette_t &palette = m_palclient->palette();
 		const rgb_t *adjusted_palette = palette.entry_list_adjusted();
 
@@ -1082,8 +1158,9 @@ void render_target::set_view(unsigned viewindex)
 	if (m_views.size() > viewindex)
 	{
 		m_curview = viewindex;
+		m_element_cache.clear();
 		current_view().recompute(visibility_mask(), m_layerconfig.zoom_to_screen());
-		current_view().preload();
+		current_view().preload(m_manager.m_preload_queue);
 	}
 }
 
@@ -1113,7 +1190,7 @@ void render_target::set_visibility_toggle(unsigned index, bool enable)
 	else
 		m_views[m_curview].second &= ~(u32(1) << index);
 	current_view().recompute(visibility_mask(), m_layerconfig.zoom_to_screen());
-	current_view().preload();
+	current_view().preload(m_manager.m_preload_queue);
 }
 
 
@@ -1458,6 +1535,7 @@ render_primitive_list &render_target::get_primitives()
 	{
 		// we're running - iterate over items in the view
 		current_view().prepare_items();
+		unsigned elementindex = 0;
 		for (layout_view_item &curitem : current_view().visible_items())
 		{
 			// first apply orientation to the bounds
@@ -1479,7 +1557,11 @@ render_primitive_list &render_target::get_primitives()
 			if (curitem.screen())
 				add_container_primitives(list, root_xform, item_xform, curitem.screen()->container(), curitem.blend_mode());
 			else
-				add_element_primitives(list, item_xform, curitem);
+			{
+				if (m_element_cache.size() <= elementindex)
+					m_element_cache.resize(elementindex + 1);
+				add_element_primitives(list, item_xform, curitem, m_element_cache[elementindex++]);
+			}
 		}
 	}
 	else
@@ -1671,6 +1753,11 @@ void render_target::invalidate_all(void *refptr)
 			list.release_all();
 		list.release_lock();
 	}
+
+	// forget any cached element primitives that refer to it
+	for (element_cache_entry &entry : m_element_cache)
+		if (entry.refptr == refptr)
+			entry = element_cache_entry();
 }
 
 
@@ -1684,7 +1771,7 @@ void render_target::resolve_tags()
 		file.resolve_tags();
 
 	current_view().recompute(visibility_mask(), m_layerconfig.zoom_to_screen());
-	current_view().preload();
+	current_view().preload(m_manager.m_preload_queue);
 }
 
 
@@ -1695,6 +1782,7 @@ void render_target::resolve_tags()
 
 void render_target::update_layer_config()
 {
+	m_element_cache.clear();
 	current_view().recompute(visibility_mask(), m_layerconfig.zoom_to_screen());
 }
 
@@ -2431,13 +2519,26 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					width = std::min(width, m_maxtexwidth);
 					height = std::min(height, m_maxtexheight);
 
-					curitem.texture()->get_scaled(width, height, prim->texture, list, curitem.flags());
+					// characters come from the font's glyph atlas where possible, so runs of text share a texture
+					render_bounds texbounds{ 0.0f, 0.0f, 1.0f, 1.0f };
+					render_texture *texture = curitem.font() ? curitem.font()->get_char_atlas_texture(curitem.character(), width, height, list, texbounds) : nullptr;
+					if (!texture)
+						texture = curitem.texture();
 
-					// set the palette
-					prim->texture.palette = curitem.texture()->get_adjusted_palette(container, prim->texture.palette_length);
+					// set the palette first, since a changed lookup table bumps the sequence number
+					prim->texture.palette = texture->get_adjusted_palette(container, prim->texture.palette_length);
+					texture->get_scaled(width, height, prim->texture, list, curitem.flags());
 
 					// determine UV coordinates
 					prim->texcoords = oriented_texcoords[finalorient];
+					if (texture != curitem.texture())
+					{
+						for (render_texuv *uv : { &prim->texcoords.tl, &prim->texcoords.tr, &prim->texcoords.bl, &prim->texcoords.br })
+						{
+							uv->u = texbounds.x0 + (uv->u * texbounds.width());
+							uv->v = texbounds.y0 + (uv->v * texbounds.height());
+						}
+					}
 
 					// apply clipping
 					clipped = render_clip_quad(prim->bounds, cliprect, &prim->texcoords);
@@ -2445,7 +2546,7 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					// apply the final orientation from the quad flags and then build up the final flags
 					prim->flags |= (curitem.flags() & ~(PRIMFLAG_TEXORIENT_MASK | PRIMFLAG_BLENDMODE_MASK | PRIMFLAG_TEXFORMAT_MASK))
 						| PRIMFLAG_TEXORIENT(finalorient)
-						| PRIMFLAG_TEXFORMAT(curitem.texture()->format());
+						| PRIMFLAG_TEXFORMAT(texture->format());
 					prim->flags |= blendmode != -1
 						? PRIMFLAG_BLENDMODE(blendmode)
 						: PRIMFLAG_BLENDMODE(PRIMFLAG_GET_BLENDMODE(curitem.flags()));
@@ -2559,10 +2660,11 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 
 //-------------------------------------------------
 //  add_element_primitives - add the primitive
-//  for an element in the current state
+//  for an element in the current state, reusing
+//  the cached one if nothing has changed
 //-------------------------------------------------
 
-void render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view_item &item)
+void render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view_item &item, element_cache_entry &cache)
 {
 	layout_element &element(*item.element());
 	int const blendmode(item.blend_mode());
@@ -2572,7 +2674,25 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 
 	// get a pointer to the relevant texture
 	render_texture *texture = element.state_texture(state);
-	if (texture)
+	if (texture && cache.matches(item, *texture, xform, m_bounds, m_maxtexwidth, m_maxtexheight))
+	{
+		// same item, state, transform and texture as last time: copy the primitive we built then
+		render_primitive *prim = list.alloc(render_primitive::QUAD);
+		prim->bounds = cache.prim.bounds;
+		prim->full_bounds = cache.prim.full_bounds;
+		prim->color = cache.prim.color;
+		prim->flags = cache.prim.flags;
+		prim->texture = cache.prim.texture;
+		prim->texcoords = cache.prim.texcoords;
+		if (cache.refptr)
+		{
+			// reusing a scaled copy counts as a use for the cache's eviction order
+			list.add_reference(cache.refptr);
+			m_manager.touch_scaled(*texture, cache.texwidth, cache.texheight, cache.refptr);
+		}
+		list.append_or_return(*prim, cache.clipped);
+	}
+	else if (texture)
 	{
 		render_primitive *prim = list.alloc(render_primitive::QUAD);
 
@@ -2597,7 +2717,7 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 		s32 texheight = render_round_nearest(((xform.orientation & ORIENTATION_SWAP_XY) ? primwidth : primheight) / ysize);
 		texwidth = (std::min)(texwidth, m_maxtexwidth);
 		texheight = (std::min)(texheight, m_maxtexheight);
-		texture->get_scaled(texwidth, texheight, prim->texture, list, prim->flags);
+		void *const refptr = texture->get_scaled(texwidth, texheight, prim->texture, list, prim->flags);
 
 		// compute the clip rect
 		render_bounds cliprect = prim->bounds & m_bounds;
@@ -2642,6 +2762,30 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 
 		// add to the list or free if we're clipped out
 		bool const clipped = render_clip_quad(prim->bounds, cliprect, &prim->texcoords);
+
+		// remember what we built; any previous ID has been reported now
+		cache.item = &item;
+		cache.texture = texture;
+		cache.texseq = texture->m_curseq;
+		cache.texid = texture->m_id;
+		cache.xform = xform;
+		cache.blendmode = blendmode;
+		cache.scroll_wrap_x = item.scroll_wrap_x();
+		cache.scroll_wrap_y = item.scroll_wrap_y();
+		cache.scroll_size_x = xsize;
+		cache.scroll_size_y = ysize;
+		cache.scroll_pos_x = item.scroll_pos_x();
+		cache.scroll_pos_y = item.scroll_pos_y();
+		cache.bounds = m_bounds;
+		cache.maxtexwidth = m_maxtexwidth;
+		cache.maxtexheight = m_maxtexheight;
+		cache.prim = *prim;
+		cache.prim.texture.old_id = ~0ULL;
+		cache.refptr = refptr;
+		cache.texwidth = texwidth;
+		cache.texheight = texheight;
+		cache.clipped = clipped;
+
 		list.append_or_return(*prim, clipped);
 	}
 }
@@ -2794,7 +2938,7 @@ void render_target::config_load(util::xml::data_node const *targetnode)
 		if (&current_view() == &view->first)
 		{
 			current_view().recompute(visibility_mask(), m_layerconfig.zoom_to_screen());
-			current_view().preload();
+			current_view().preload(m_manager.m_preload_queue);
 		}
 	}
 }
@@ -3154,9 +3298,13 @@ done:
 render_manager::render_manager(running_machine &machine)
 	: m_machine(machine)
 	, m_ui_target(nullptr)
+	, m_scaled_bytes(0)
+	, m_scaled_hits(0)
+	, m_scaled_misses(0)
 	, m_live_textures(0)
 	, m_texture_id(0)
 	, m_ui_container(std::make_unique<render_container>(*this))
+	, m_preload_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI))
 {
 	// register callbacks
 	machine.configuration().config_register(
@@ -3176,12 +3324,17 @@ render_manager::render_manager(running_machine &machine)
 
 render_manager::~render_manager()
 {
+	osd_printf_verbose("Scaled textures: %u hits, %u misses, %u bytes cached\n", m_scaled_hits, m_scaled_misses, m_scaled_bytes);
+
 	// free all the containers since they may own textures
 	m_ui_container.reset();
 	m_screen_container_list.clear();
 
 	// better not be any outstanding textures when we die
 	assert(m_live_textures == 0);
+
+	if (m_preload_queue)
+		osd_work_queue_free(m_preload_queue);
 }
 
 
@@ -3358,6 +3511,93 @@ void render_manager::texture_free(render_texture *texture)
 }
 
 
+//-------------------------------------------------
+//  find_scaled - look for a scaled copy of a
+//  texture at a given size
+//-------------------------------------------------
+
+bitmap_argb32 *render_manager::find_scaled(render_texture const &texture, u32 width, u32 height)
+{
+	auto const found = m_scaled_index.find(scaled_texture_key(&texture, width, height));
+	if (found == m_scaled_index.end())
+	{
+		m_scaled_misses++;
+		return nullptr;
+	}
+
+	// move it to the front of the list
+	m_scaled_hits++;
+	m_scaled_textures.splice(m_scaled_textures.begin(), m_scaled_textures, found->second);
+	return found->second->bitmap.get();
+}
+
+
+//-------------------------------------------------
+//  touch_scaled - note a use of a scaled copy
+//  found without a lookup; does nothing if the
+//  bitmap isn't a scaled copy
+//-------------------------------------------------
+
+void render_manager::touch_scaled(render_texture const &texture, u32 width, u32 height, void const *bitmap)
+{
+	auto const found = m_scaled_index.find(scaled_texture_key(&texture, width, height));
+	if ((found == m_scaled_index.end()) || (found->second->bitmap.get() != bitmap))
+		return;
+
+	// move it to the front of the list
+	m_scaled_hits++;
+	m_scaled_textures.splice(m_scaled_textures.begin(), m_scaled_textures, found->second);
+}
+
+
+//-------------------------------------------------
+//  alloc_scaled - make room for and allocate a
+//  new scaled copy of a texture
+//-------------------------------------------------
+
+bitmap_argb32 &render_manager::alloc_scaled(render_texture const &texture, u32 width, u32 height, render_primitive_list const &primlist)
+{
+	// evict the least recently used copies until there is room, skipping any the list being built still needs
+	u64 const bytes = u64(width) * height * sizeof(u32);
+	for (auto it = m_scaled_textures.end(); (m_scaled_bytes + bytes > SCALED_TEXTURE_BUDGET) && (it != m_scaled_textures.begin()); )
+	{
+		--it;
+		if (!primlist.has_reference(it->bitmap.get()))
+			it = free_scaled(it);
+	}
+
+	// the budget is a target rather than a hard limit, so always allocate
+	m_scaled_textures.push_front(scaled_texture{ &texture, width, height, std::make_unique<bitmap_argb32>(width, height) });
+	m_scaled_index.emplace(scaled_texture_key(&texture, width, height), m_scaled_textures.begin());
+	m_scaled_bytes += u64(m_scaled_textures.front().bitmap->rowpixels()) * height * sizeof(u32);
+	return *m_scaled_textures.front().bitmap;
+}
+
+
+//-------------------------------------------------
+//  free_scaled - free scaled copies of a texture
+//-------------------------------------------------
+
+void render_manager::free_scaled(render_texture const &texture)
+{
+	for (auto it = m_scaled_textures.begin(); it != m_scaled_textures.end(); )
+	{
+		if (it->texture == &texture)
+			it = free_scaled(it);
+		else
+			++it;
+	}
+}
+
+render_manager::scaled_texture_list::iterator render_manager::free_scaled(scaled_texture_list::iterator entry)
+{
+	invalidate_all(entry->bitmap.get());
+	m_scaled_bytes -= u64(entry->bitmap->rowpixels()) * entry->height * sizeof(u32);
+	m_scaled_index.erase(scaled_texture_key(entry->texture, entry->width, entry->height));
+	return m_scaled_textures.erase(entry);
+}
+
+
 //-------------------------------------------------
 //  font_alloc - allocate a new font instance
 //-------------------------------------------------
@@ -50,8 +50,10 @@
 
 #include <cmath>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -160,10 +162,27 @@ struct render_texinfo
 	u32                 width_margin;       // left margin of the scaled bounds, if applicable
 	u32                 height;             // height of the image
 	u32                 seqid;              // sequence ID
+	u32                 dirty_seqid;        // sequence ID the dirty rows are relative to
+	u32                 dirty_top;          // first row changed since dirty_seqid
+	u32                 dirty_bottom;       // last row changed since dirty_seqid; less than dirty_top if none
 	u64                 unique_id;          // unique identifier to pass to osd
 	u64                 old_id;             // previously allocated id, if applicable
 	const rgb_t *       palette;            // palette for PALETTE16 textures, bcg lookup table for RGB32/YUY16
 	u32                 palette_length;
+
+	// rows that need converting again for a copy made at sequence ID cachedseq; returns false for a full update
+	bool changed_rows(u32 cachedseq, u32 &top, u32 &bottom) const
+	{
+		if (cachedseq == dirty_seqid)
+		{
+			top = dirty_top;
+			bottom = dirty_bottom;
+			return true;
+		}
+		top = 0;
+		bottom = height - 1;
+		return false;
+	}
 };
 
 
@@ -326,8 +345,9 @@ public:
 	int format() const { return m_format; }
 	render_manager *manager() const { return m_manager; }
 
-	// configure the texture bitmap
+	// configure the texture bitmap, optionally noting that only some rows have changed since the last call
 	void set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, texture_format format);
+	void set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, texture_format format, s32 dirtytop, s32 dirtybottom);
 
 	// set a unique identifier
 	void set_id(u64 id) { m_old_id = m_id; m_id = id; }
@@ -337,17 +357,9 @@ public:
 
 private:
 	// internal helpers
-	void get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0);
+	void *get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0);
 	const rgb_t *get_adjusted_palette(render_container &container, u32 &out_length);
-
-	static constexpr int MAX_TEXTURE_SCALES = 100;
-
-	// a scaled_texture contains a single scaled entry for a texture
-	struct scaled_texture
-	{
-		std::unique_ptr<bitmap_argb32>  bitmap;     // final bitmap
-		u32                             seqid;      // sequence number
-	};
+	void mark_all_dirty();
 
 	// internal state
 	render_manager *    m_manager;                  // reference to our manager
@@ -362,7 +374,12 @@ private:
 	texture_scaler_func m_scaler;                   // scaling callback
 	void *              m_param;                    // scaling callback parameter
 	u32                 m_curseq;                   // current sequence number
-	scaled_texture      m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
+
+	// partial update state (unscaled textures only)
+	u32                 m_dirty_seq;                // sequence number the dirty rows are relative to
+	s32                 m_dirty_top;                // first changed row, relative to the source bounds
+	s32                 m_dirty_bottom;             // last changed row, relative to the source bounds
+	u32                 m_lookup_seq;               // container lookup table the texture was last converted with
 };
 
 
@@ -373,6 +390,7 @@ class render_container
 {
 	friend class render_manager;
 	friend class render_target;
+	friend class render_texture;
 
 public:
 	// construction/destruction
@@ -436,7 +454,7 @@ private:
 		friend class simple_list<item>;
 
 	public:
-		item() : m_next(nullptr), m_type(0), m_flags(0), m_internal(0), m_width(0), m_texture(nullptr) { }
+		item() : m_next(nullptr), m_type(0), m_flags(0), m_internal(0), m_width(0), m_texture(nullptr), m_font(nullptr), m_char(0) { }
 
 		// getters
 		item *next() const { return m_next; }
@@ -447,6 +465,8 @@ private:
 		u32 internal() const { return m_internal; }
 		float width() const { return m_width; }
 		render_texture *texture() const { return m_texture; }
+		render_font *font() const { return m_font; }
+		char32_t character() const { return m_char; }
 
 	private:
 		// internal state
@@ -458,6 +478,8 @@ private:
 		u32                 m_internal;         // internal flags
 		float               m_width;            // width of the line (lines only)
 		render_texture *    m_texture;          // pointer to the source texture (quads only)
+		render_font *       m_font;             // font to take the glyph atlas from (characters only)
+		char32_t            m_char;             // character code (characters only)
 	};
 
 	// generic screen overlay scaler
@@ -479,6 +501,7 @@ private:
 	render_texture *        m_overlaytexture;       // overlay texture
 	std::unique_ptr<palette_client> m_palclient;    // client to the screen palette
 	std::vector<rgb_t>      m_bcglookup;            // copy of screen palette with bcg adjustment
+	u32                     m_lookup_seq;           // bumped whenever the lookup tables change
 	rgb_t                   m_bcglookup256[0x400];  // lookup table for brightness/contrast/gamma
 };
 
@@ -569,6 +592,7 @@ private:
 
 	// private classes declared in render.cpp
 	struct object_transform;
+	struct element_cache_entry;
 
 	// internal helpers
 	enum constructor_impl_t { CONSTRUCTOR_IMPL };
@@ -581,7 +605,7 @@ private:
 	bool load_layout_file(const char *dirname, const internal_layout &layout_data, device_t *device = nullptr);
 	bool load_layout_file(device_t &device, util::xml::data_node const &rootnode, const char *searchpath, const char *dirname);
 	void add_container_primitives(render_primitive_list &list, const object_transform &root_xform, const object_transform &xform, render_container &container, int blendmode);
-	void add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view_item &item);
+	void add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view_item &item, element_cache_entry &cache);
 	std::pair<float, float> map_point_internal(s32 target_x, s32 target_y);
 
 	// config callbacks
@@ -630,6 +654,7 @@ private:
 	render_layer_config     m_base_layerconfig;         // the layer configuration at the time of first frame
 	int                     m_maxtexwidth;              // maximum width of a texture
 	int                     m_maxtexheight;             // maximum height of a texture
+	std::vector<element_cache_entry> m_element_cache;   // primitives last built for each element item, in view order
 	s32                     m_clear_extent_count;       // number of clear extents
 	s32                     m_clear_extents[MAX_CLEAR_EXTENTS]; // array of clear extents
 	bool                    m_transform_container;      // determines whether the screen container is transformed by the core renderer,
@@ -644,6 +669,7 @@ private:
 class render_manager
 {
 	friend class render_target;
+	friend class render_texture;
 
 public:
 	// construction/destruction
@@ -680,6 +706,11 @@ public:
 	// fonts
 	std::unique_ptr<render_font> font_alloc(const char *filename = nullptr);
 
+	// scaled texture cache statistics
+	u64 scaled_texture_hits() const { return m_scaled_hits; }
+	u64 scaled_texture_misses() const { return m_scaled_misses; }
+	u64 scaled_texture_bytes() const { return m_scaled_bytes; }
+
 	// reference tracking
 	void invalidate_all(void *refptr);
 
@@ -687,6 +718,27 @@ public:
 	void resolve_tags();
 
 private:
+	// a scaled_texture is one scaled copy of an ARGB32 texture, shared by every target
+	struct scaled_texture
+	{
+		render_texture const *          texture;    // texture it was scaled from
+		u32                             width;      // scaled width
+		u32                             height;     // scaled height
+		std::unique_ptr<bitmap_argb32>  bitmap;     // final bitmap
+	};
+	using scaled_texture_list = std::list<scaled_texture>;
+	using scaled_texture_key = std::tuple<render_texture const *, u32, u32>;
+
+	// scaled textures are evicted least recently used first once they use this much memory
+	static constexpr u64 SCALED_TEXTURE_BUDGET = 256 * 1024 * 1024;
+
+	// scaled texture cache
+	bitmap_argb32 *find_scaled(render_texture const &texture, u32 width, u32 height);
+	void touch_scaled(render_texture const &texture, u32 width, u32 height, void const *bitmap);
+	bitmap_argb32 &alloc_scaled(render_texture const &texture, u32 width, u32 height, render_primitive_list const &primlist);
+	void free_scaled(render_texture const &texture);
+	scaled_texture_list::iterator free_scaled(scaled_texture_list::iterator entry);
+
 	// config callbacks
 	void config_load(config_type cfg_type, config_level cfg_lvl, util::xml::data_node const *parentnode);
 	void config_save(config_type cfg_type, util::xml::data_node *parentnode);
@@ -698,6 +750,13 @@ private:
 	simple_list<render_target>      m_targetlist;       // list of targets
 	render_target *                 m_ui_target;        // current UI target
 
+	// scaled textures, most recently used first; declared before the texture allocator so textures can still purge them while being destroyed
+	scaled_texture_list             m_scaled_textures;  // every scaled copy
+	std::map<scaled_texture_key, scaled_texture_list::iterator> m_scaled_index; // lookup by texture and size
+	u64                             m_scaled_bytes;     // memory used by scaled copies
+	u64                             m_scaled_hits;      // lookups that found a scaled copy
+	u64                             m_scaled_misses;    // lookups that had to scale
+
 	// texture lists
 	u32                             m_live_textures;    // number of live textures
 	u64                             m_texture_id;       // rolling texture ID counter
@@ -706,6 +765,9 @@ private:
 	// containers for the UI and for screens
 	std::unique_ptr<render_container> m_ui_container;   // UI container
 	std::list<render_container>     m_screen_container_list; // list of containers for the screen
+
+	// shared by every target for loading layout artwork in parallel
+	osd_work_queue *                m_preload_queue;    // queue for preloading layout elements
 };
 
 #endif  // MAME_EMU_RENDER_H
@@ -6,6 +6,11 @@
 
     Software-only rasterization system.
 
+    When given a work queue, draw_primitives splits the destination
+    into horizontal bands and draws each band on its own thread.
+    Every band walks the whole primitive list clipped to its rows, so
+    primitive order within a pixel is unchanged.
+
 ***************************************************************************/
 
 
@@ -14,6 +19,17 @@
 #include "video/rgbutil.h"
 #include "render.h"
 
+#include "osdcore.h"
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_RENDERSW_SSE2
+#include <emmintrin.h>
+#endif
+
 
 template <typename PixelType, int SrcShiftR, int SrcShiftG, int SrcShiftB, int DstShiftR, int DstShiftG, int DstShiftB, bool NoDestRead = false, bool BilinearFilter = false>
 class software_renderer
@@ -28,6 +44,18 @@ private:
 		s32 endx, endy;
 	};
 
+	struct band_data
+	{
+		render_primitive_list const *primlist;
+		PixelType *dstdata;
+		s32 width, miny, maxy;
+		u32 pitch;
+	};
+
+	// bands are split no finer than this, and there are never more than MAX_BANDS
+	static constexpr s32 MIN_BAND_ROWS = 32;
+	static constexpr int MAX_BANDS = 64;
+
 	// internal helpers
 	static constexpr bool is_opaque(float alpha) { return (alpha >= (NoDestRead ? 0.5f : 1.0f)); }
 	static constexpr bool is_transparent(float alpha) { return (alpha < (NoDestRead ? 0.5f : 0.0001f)); }
@@ -57,6 +85,42 @@ private:
 			return dest_assemble_rgb(source32_r(pixel), source32_g(pixel), source32_b(pixel));
 	}
 
+	// 32bpp destinations in the standard format can be blended a whole pixel at a time
+	static constexpr bool dest_is_source32 = std::is_same_v<PixelType, u32> && !NoDestRead &&
+			SrcShiftR == 0 && SrcShiftG == 0 && SrcShiftB == 0 && DstShiftR == 16 && DstShiftG == 8 && DstShiftB == 0;
+
+
+#ifdef MAME_RENDERSW_SSE2
+	//-------------------------------------------------
+	//  blend_argb32_sse2 - alpha blend four ARGB
+	//  texels over four destination pixels exactly
+	//  like draw_quad_argb32_alpha does one at a
+	//  time; needs dest_is_source32
+	//-------------------------------------------------
+
+	static inline __m128i blend_argb32_sse2(__m128i src, __m128i dst)
+	{
+		__m128i const zero = _mm_setzero_si128();
+		__m128i const s0 = _mm_unpacklo_epi8(src, zero);
+		__m128i const s1 = _mm_unpackhi_epi8(src, zero);
+		__m128i const d0 = _mm_unpacklo_epi8(dst, zero);
+		__m128i const d1 = _mm_unpackhi_epi8(dst, zero);
+
+		// spread each texel's alpha across its channels; s * a + d * (256 - a) never exceeds 16 bits
+		__m128i const a0 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s0, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		__m128i const a1 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s1, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		__m128i const inva0 = _mm_sub_epi16(_mm_set1_epi16(0x100), a0);
+		__m128i const inva1 = _mm_sub_epi16(_mm_set1_epi16(0x100), a1);
+		__m128i const r0 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(s0, a0), _mm_mullo_epi16(d0, inva0)), 8);
+		__m128i const r1 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(s1, a1), _mm_mullo_epi16(d1, inva1)), 8);
+		__m128i const result = _mm_and_si128(_mm_packus_epi16(r0, r1), _mm_set1_epi32(0x00ffffff));
+
+		// fully transparent texels leave the destination untouched
+		__m128i const keep = _mm_cmpeq_epi32(_mm_and_si128(src, _mm_set1_epi32(s32(0xff000000))), zero);
+		return _mm_or_si128(_mm_and_si128(keep, dst), _mm_andnot_si128(keep, result));
+	}
+#endif
+
 
 	//-------------------------------------------------
 	//  ycc_to_rgb - convert YCC to RGB; the YCC pixel
@@ -415,10 +479,21 @@ private:
 	//  draw_line - draw a line or point
 	//-------------------------------------------------
 
-	static void draw_line(render_primitive const &prim, PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void draw_line(render_primitive const &prim, PixelType *dstdata, s32 width, s32 miny, s32 maxy, u32 pitch)
 	{
-		// internal tables
-		static u32 s_cosine_table[2049];
+		// internal tables; built once, as bands may be drawing lines on several threads
+		static std::array<u32, 2049> const s_cosine_table = [] ()
+		{
+			std::array<u32, 2049> table;
+			for (int entry = 0; entry <= 2048; entry++)
+				table[entry] = int(double(1.0 / cos(atan(double(entry) / 2048.0))) * 0x10000000 + 0.5);
+			return table;
+		}();
+
+		// skip lines that can't reach this band, allowing for the beam width
+		float const reach = PRIMFLAG_GET_ANTIALIAS(prim.flags) ? (std::max(prim.width, 1.0f) + 2.0f) : 1.0f;
+		if ((std::min(prim.bounds.y0, prim.bounds.y1) - reach >= float(maxy)) || (std::max(prim.bounds.y0, prim.bounds.y1) + reach < float(miny)))
+			return;
 
 		// compute the start/end coordinates
 		int x1 = int(prim.bounds.x0 * 65536.0f);
@@ -431,11 +506,6 @@ private:
 
 		if (PRIMFLAG_GET_ANTIALIAS(prim.flags))
 		{
-			// build up the cosine table if we haven't yet
-			if (s_cosine_table[0] == 0)
-				for (int entry = 0; entry <= 2048; entry++)
-					s_cosine_table[entry] = int(double(1.0 / cos(atan(double(entry) / 2048.0))) * 0x10000000 + 0.5);
-
 			int beam = prim.width * 65536.0f;
 			if (beam < 0x00010000)
 				beam = 0x00010000;
@@ -460,7 +530,7 @@ private:
 					{
 						dx = bwidth;    // init diameter of beam
 						dy = y1 >> 16;
-						if (dy >= 0 && dy < height)
+						if (dy >= miny && dy < maxy)
 							draw_aa_pixel(dstdata, pitch, x1, dy, apply_intensity(0xff & (~y1 >> 8), col));
 						dy++;
 						dx -= 0x10000 - (0xffff & y1); // take off amount plotted
@@ -468,11 +538,11 @@ private:
 						dx >>= 16;                   // adjust to pixel (solid) count
 						while (dx--)                 // plot rest of pixels
 						{
-							if (dy >= 0 && dy < height)
+							if (dy >= miny && dy < maxy)
 								draw_aa_pixel(dstdata, pitch, x1, dy, col);
 							dy++;
 						}
-						if (dy >= 0 && dy < height)
+						if (dy >= miny && dy < maxy)
 							draw_aa_pixel(dstdata, pitch, x1, dy, apply_intensity(a1,col));
 					}
 					if (x1 == xx) break;
@@ -492,7 +562,7 @@ private:
 				x1 -= bwidth >> 1; // start back half the width
 				for (;;)
 				{
-					if (y1 >= 0 && y1 < height)
+					if (y1 >= miny && y1 < maxy)
 					{
 						dy = bwidth;    // calc diameter of beam
 						dx = x1 >> 16;
@@ -535,7 +605,7 @@ private:
 			{
 				for (;;)
 				{
-					if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height)
+					if (x1 >= 0 && x1 < width && y1 >= miny && y1 < maxy)
 						draw_aa_pixel(dstdata, pitch, x1, y1, col);
 					if (x1 == x2) break;
 					x1 += sx;
@@ -551,7 +621,7 @@ private:
 			{
 				for (;;)
 				{
-					if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height)
+					if (x1 >= 0 && x1 < width && y1 >= miny && y1 < maxy)
 						draw_aa_pixel(dstdata, pitch, x1, y1, col);
 					if (y1 == y2) break;
 					y1 += sy;
@@ -576,7 +646,7 @@ private:
 	//  draw_rect - draw a solid rectangle
 	//-------------------------------------------------
 
-	static void draw_rect(render_primitive const &prim, PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void draw_rect(render_primitive const &prim, PixelType *dstdata, s32 width, s32 miny, s32 maxy, u32 pitch)
 	{
 		render_bounds const fpos = prim.bounds;
 		assert(fpos.x0 <= fpos.x1);
@@ -584,9 +654,9 @@ private:
 
 		// clamp to integers and ensure we fit
 		s32 const startx = std::clamp<s32>(round_nearest(fpos.x0), 0, width);
-		s32 const starty = std::clamp<s32>(round_nearest(fpos.y0), 0, height);
+		s32 const starty = std::clamp<s32>(round_nearest(fpos.y0), miny, maxy);
 		s32 const endx = std::clamp<s32>(round_nearest(fpos.x1), 0, width);
-		s32 const endy = std::clamp<s32>(round_nearest(fpos.y1), 0, height);
+		s32 const endy = std::clamp<s32>(round_nearest(fpos.y1), miny, maxy);
 
 		// bail if nothing left
 		if ((startx > endx) || (starty > endy))
@@ -1452,9 +1522,33 @@ private:
 				if (!palbase)
 				{
 					// no lookup case
+					s32 x = setup.startx;
+
+#ifdef MAME_RENDERSW_SSE2
+					// four pixels at a time while they last
+					if constexpr (dest_is_source32)
+					{
+						for ( ; x + 4 <= setup.endx; x += 4, dest += 4)
+						{
+							u32 texel[4];
+							for (u32 &pix : texel)
+							{
+								pix = get_texel_argb32<Wrap>(prim.texture, curu, curv);
+								curu += setup.dudx;
+								curv += setup.dvdx;
+							}
+							__m128i const src = _mm_loadu_si128(reinterpret_cast<__m128i const *>(texel));
+							if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(src, _mm_set1_epi32(s32(0xff000000))), _mm_setzero_si128())) != 0xffff)
+							{
+								__m128i *const d = reinterpret_cast<__m128i *>(dest);
+								_mm_storeu_si128(d, blend_argb32_sse2(src, _mm_loadu_si128(d)));
+							}
+						}
+					}
+#endif
 
 					// loop over cols
-					for (s32 x = setup.startx; x < setup.endx; x++)
+					for ( ; x < setup.endx; x++)
 					{
 						u32 const pix = get_texel_argb32<Wrap>(prim.texture, curu, curv);
 						u32 const ta = pix >> 24;
@@ -1727,11 +1821,17 @@ private:
 	//  drawing routine
 	//-------------------------------------------------
 
-	static void setup_and_draw_textured_quad(render_primitive const &prim, PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void setup_and_draw_textured_quad(render_primitive const &prim, PixelType *dstdata, s32 width, s32 miny, s32 maxy, u32 pitch)
 	{
 		assert(prim.bounds.x0 <= prim.bounds.x1);
 		assert(prim.bounds.y0 <= prim.bounds.y1);
 
+		// bail early if the quad doesn't touch this band
+		s32 const firsty = round_nearest(prim.bounds.y0);
+		s32 const lasty = round_nearest(prim.bounds.y1);
+		if ((firsty >= maxy) || (lasty <= miny))
+			return;
+
 		// determine U/V deltas
 		float const fdudx = (prim.texcoords.tr.u - prim.texcoords.tl.u) / (prim.bounds.x1 - prim.bounds.x0);
 		float const fdvdx = (prim.texcoords.tr.v - prim.texcoords.tl.v) / (prim.bounds.x1 - prim.bounds.x0);
@@ -1741,19 +1841,15 @@ private:
 		// clamp to integers
 		quad_setup_data setup;
 		setup.startx = round_nearest(prim.bounds.x0);
-		setup.starty = round_nearest(prim.bounds.y0);
+		setup.starty = std::max(firsty, miny);
 		setup.endx = round_nearest(prim.bounds.x1);
-		setup.endy = round_nearest(prim.bounds.y1);
+		setup.endy = std::min(lasty, maxy);
 
 		// ensure we fit
 		if (setup.startx < 0) setup.startx = 0;
 		if (setup.startx >= width) setup.startx = width;
 		if (setup.endx < 0) setup.endx = 0;
 		if (setup.endx >= width) setup.endx = width;
-		if (setup.starty < 0) setup.starty = 0;
-		if (setup.starty >= height) setup.starty = height;
-		if (setup.endy < 0) setup.endy = 0;
-		if (setup.endy >= height) setup.endy = height;
 
 		// compute start and delta U,V coordinates now
 		setup.dudx = round_nearest(65536.0f * float(prim.texture.width) * fdudx);
@@ -1774,6 +1870,13 @@ private:
 			setup.startv -= 0x8000;
 		}
 
+		// step U/V past any rows clipped off by the top of a lower band so bands
+		// join up seamlessly; rows above the target are not skipped, matching
+		// what a single band covering the whole target has always drawn
+		s32 const skipped = setup.starty - std::max(firsty, 0);
+		setup.startu += skipped * setup.dudy;
+		setup.startv += skipped * setup.dvdy;
+
 		// render based on the texture coordinates
 		switch (prim.flags & (PRIMFLAG_TEXFORMAT_MASK | PRIMFLAG_BLENDMODE_MASK))
 		{
@@ -1845,30 +1948,75 @@ private:
 	//**************************************************************************
 
 	//-------------------------------------------------
-	//  draw_primitives - draw a series of primitives
-	//  using a software rasterizer
+	//  draw_band - draw every primitive, clipped to
+	//  one band of destination rows
 	//-------------------------------------------------
 
-public:
-	static void draw_primitives(render_primitive_list const &primlist, void *dstdata, u32 width, u32 height, u32 pitch)
+	static void draw_band(band_data const &band)
 	{
 		// loop over the list and render each element
-		for (render_primitive const *prim = primlist.first(); prim != nullptr; prim = prim->next())
+		for (render_primitive const *prim = band.primlist->first(); prim != nullptr; prim = prim->next())
 			switch (prim->type)
 			{
 				case render_primitive::LINE:
-					draw_line(*prim, reinterpret_cast<PixelType *>(dstdata), width, height, pitch);
+					draw_line(*prim, band.dstdata, band.width, band.miny, band.maxy, band.pitch);
 					break;
 
 				case render_primitive::QUAD:
 					if (!prim->texture.base)
-						draw_rect(*prim, reinterpret_cast<PixelType *>(dstdata), width, height, pitch);
+						draw_rect(*prim, band.dstdata, band.width, band.miny, band.maxy, band.pitch);
 					else
-						setup_and_draw_textured_quad(*prim, reinterpret_cast<PixelType *>(dstdata), width, height, pitch);
+						setup_and_draw_textured_quad(*prim, band.dstdata, band.width, band.miny, band.maxy, band.pitch);
 					break;
 
 				default:
-					throw emu_fatalerror("Unexpected render_primitive type");
+					// rejected by draw_primitives before any band is drawn
+					break;
 			}
 	}
+
+	static void *draw_band_callback(void *param, int threadid)
+	{
+		draw_band(*reinterpret_cast<band_data const *>(param));
+		return nullptr;
+	}
+
+
+	//-------------------------------------------------
+	//  draw_primitives - draw a series of primitives
+	//  using a software rasterizer, optionally
+	//  spreading horizontal bands across a queue
+	//-------------------------------------------------
+
+public:
+	static void draw_primitives(render_primitive_list const &primlist, void *dstdata, u32 width, u32 height, u32 pitch, osd_work_queue *queue = nullptr)
+	{
+		// check the list here, as bands may be drawn on worker threads that can't throw
+		for (render_primitive const *prim = primlist.first(); prim != nullptr; prim = prim->next())
+			if ((prim->type != render_primitive::LINE) && (prim->type != render_primitive::QUAD))
+				throw emu_fatalerror("Unexpected render_primitive type");
+
+		int const bandcount = queue ? std::min<int>(MAX_BANDS, height / MIN_BAND_ROWS) : 1;
+		if (bandcount <= 1)
+		{
+			draw_band(band_data{ &primlist, reinterpret_cast<PixelType *>(dstdata), s32(width), 0, s32(height), pitch });
+			return;
+		}
+
+		// bands cover disjoint rows, so they can all be drawn at once
+		band_data bands[MAX_BANDS];
+		for (int band = 0; band < bandcount; band++)
+		{
+			bands[band].primlist = &primlist;
+			bands[band].dstdata = reinterpret_cast<PixelType *>(dstdata);
+			bands[band].width = width;
+			bands[band].miny = height * band / bandcount;
+			bands[band].maxy = height * (band + 1) / bandcount;
+			bands[band].pitch = pitch;
+		}
+		osd_work_item_queue_multiple(queue, draw_band_callback, bandcount, bands, sizeof(bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+
+		// the band list lives on this stack frame, so every band must finish before we return
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second() * 10)) { }
+	}
 };
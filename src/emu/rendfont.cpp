@@ -30,6 +30,7 @@
 #include <cstring>
 #include <iterator>
 #include <limits>
+#include <utility>
 
 
 #define VERBOSE 0
@@ -566,6 +567,7 @@ render_font::render_font(render_manager &manager, const char *filename)
 	, m_osdfont()
 	, m_height_cmd(0)
 	, m_yoffs_cmd(0)
+	, m_atlas_page_count(0)
 {
 	memset(m_glyphs, 0, sizeof(m_glyphs));
 	memset(m_glyphs_cmd, 0, sizeof(m_glyphs_cmd));
@@ -612,6 +614,10 @@ render_font::render_font(render_manager &manager, const char *filename)
 
 render_font::~render_font()
 {
+	// free the glyph atlas
+	while (!m_atlas_pages.empty())
+		free_atlas_pages(m_atlas_pages.begin());
+
 	// free all the subtables
 	for (auto & elem : m_glyphs)
 		if (elem)
@@ -806,6 +812,116 @@ render_texture *render_font::get_char_texture_and_bounds(float height, float asp
 }
 
 
+//-------------------------------------------------
+//  get_char_atlas_texture - return the atlas
+//  texture holding a character scaled to the
+//  given pixel size, and the normalised bounds
+//  of the character within it
+//-------------------------------------------------
+
+render_texture *render_font::get_char_atlas_texture(char32_t chnum, s32 width, s32 height, render_primitive_list const &primlist, render_bounds &texbounds)
+{
+	// large glyphs gain little from sharing a texture
+	width = std::max<s32>(width, 1);
+	height = std::max<s32>(height, 1);
+	if ((width > ATLAS_MAX_GLYPH) || (height > ATLAS_MAX_GLYPH))
+		return nullptr;
+
+	// scale the glyph into the atlas the first time we see it at this size
+	atlas_key const key(height, chnum, width);
+	auto found = m_atlas_glyphs.find(key);
+	if (m_atlas_glyphs.end() == found)
+	{
+		glyph &gl = get_char(chnum);
+		if (!gl.texture)
+			return nullptr;
+
+		atlas_page &page = atlas_space(width, height, primlist);
+		rectangle const bounds(page.x, page.x + width - 1, page.y, page.y + height - 1);
+		bitmap_argb32 dest(page.bitmap, bounds);
+		render_texture::hq_scale(dest, gl.bitmap, gl.bitmap.cliprect(), nullptr);
+		page.x += width + 1;
+
+		// bump the sequence number so the OSD uploads the new glyph
+		page.texture->set_bitmap(page.bitmap, page.bitmap.cliprect(), TEXFORMAT_ARGB32);
+		found = m_atlas_glyphs.emplace(key, atlas_glyph{ &page, bounds }).first;
+	}
+
+	// existing glyphs never move, so earlier primitives stay valid as the page fills up
+	atlas_glyph const &placed = found->second;
+	float const xscale = 1.0f / float(placed.page->bitmap.width());
+	float const yscale = 1.0f / float(placed.page->bitmap.height());
+	texbounds.x0 = float(placed.bounds.left()) * xscale;
+	texbounds.y0 = float(placed.bounds.top()) * yscale;
+	texbounds.x1 = float(placed.bounds.right() + 1) * xscale;
+	texbounds.y1 = float(placed.bounds.bottom() + 1) * yscale;
+	return placed.page->texture;
+}
+
+
+//-------------------------------------------------
+//  atlas_space - find an atlas page with room for
+//  a glyph, allocating one if necessary
+//-------------------------------------------------
+
+render_font::atlas_page &render_font::atlas_space(s32 width, s32 height, render_primitive_list const &primlist)
+{
+	// every glyph on a page has the same height, so simple shelves pack them tightly
+	atlas_page_list &pages = m_atlas_pages[height];
+	if (!pages.empty())
+	{
+		atlas_page &page = *pages.back();
+		if ((page.x + width) > page.bitmap.width())
+		{
+			page.x = 0;
+			page.y += height + 1;
+		}
+		if ((page.y + height) <= page.bitmap.height())
+			return page;
+	}
+
+	// when over budget, drop pages for other sizes that the list being built isn't using
+	for (auto it = m_atlas_pages.begin(); (ATLAS_MAX_PAGES <= m_atlas_page_count) && (m_atlas_pages.end() != it); )
+	{
+		bool const inuse = (height == it->first) || std::any_of(
+				it->second.begin(),
+				it->second.end(),
+				[&primlist] (std::unique_ptr<atlas_page> const &page) { return primlist.has_reference(&page->bitmap); });
+		if (inuse)
+			++it;
+		else
+			free_atlas_pages(it++);
+	}
+
+	// the budget is a target rather than a hard limit, so always allocate
+	auto &page = *pages.emplace_back(std::make_unique<atlas_page>());
+	page.bitmap.allocate(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+	page.bitmap.fill(0);
+	page.texture = m_manager.texture_alloc();
+	page.texture->set_bitmap(page.bitmap, page.bitmap.cliprect(), TEXFORMAT_ARGB32);
+	++m_atlas_page_count;
+	return page;
+}
+
+
+//-------------------------------------------------
+//  free_atlas_pages - free all atlas pages for a
+//  pixel height
+//-------------------------------------------------
+
+void render_font::free_atlas_pages(std::map<s32, atlas_page_list>::iterator pages)
+{
+	s32 const height = pages->first;
+	m_atlas_glyphs.erase(
+			m_atlas_glyphs.lower_bound(atlas_key(height, 0, 0)),
+			m_atlas_glyphs.lower_bound(atlas_key(height + 1, 0, 0)));
+	for (std::unique_ptr<atlas_page> const &page : pages->second)
+		m_manager.texture_free(page->texture);
+	m_atlas_page_count -= pages->second.size();
+	m_atlas_pages.erase(pages);
+}
+
+
 //-------------------------------------------------
 //  get_scaled_bitmap_and_bounds - return a
 //  scaled bitmap and bounding rect for a char
@@ -13,6 +13,11 @@
 
 #include "render.h"
 
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
@@ -42,6 +47,7 @@ public:
 
 	// texture/bitmap queries
 	render_texture *get_char_texture_and_bounds(float height, float aspect, char32_t ch, render_bounds &bounds);
+	render_texture *get_char_atlas_texture(char32_t ch, s32 width, s32 height, render_primitive_list const &primlist, render_bounds &texbounds);
 	void get_scaled_bitmap_and_bounds(bitmap_argb32 &dest, float height, float aspect, char32_t chnum, rectangle &bounds);
 
 private:
@@ -70,6 +76,23 @@ private:
 		rgb_t               color;
 	};
 
+	// an atlas_page packs glyphs scaled to one pixel height into a shared texture
+	struct atlas_page
+	{
+		bitmap_argb32       bitmap;             // scaled glyphs, separated by a transparent gutter
+		render_texture *    texture = nullptr;  // texture wrapped around the bitmap
+		s32                 x = 0, y = 0;       // next free position
+	};
+	using atlas_page_list = std::vector<std::unique_ptr<atlas_page> >;
+
+	// a placed glyph, keyed by pixel height, character and pixel width
+	using atlas_key = std::tuple<s32, char32_t, s32>;
+	struct atlas_glyph
+	{
+		atlas_page const *  page;               // page holding the scaled glyph
+		rectangle           bounds;             // pixel bounds within the page
+	};
+
 	// internal format
 	enum class format
 	{
@@ -82,6 +105,8 @@ private:
 	// helpers
 	glyph &get_char(char32_t chnum);
 	void char_expand(char32_t chnum, glyph &ch);
+	atlas_page &atlas_space(s32 width, s32 height, render_primitive_list const &primlist);
+	void free_atlas_pages(std::map<s32, atlas_page_list>::iterator pages);
 	bool load_cached_bdf(std::string_view filename);
 	bool load_bdf();
 	bool load_cached(util::random_read &file, u64 length, u32 hash);
@@ -106,8 +131,15 @@ private:
 	EQUIVALENT_ARRAY(m_glyphs, glyph *) m_glyphs_cmd; // array of glyph subtables
 	std::vector<char>   m_rawdata_cmd;      // pointer to the raw data for the font
 
+	std::map<s32, atlas_page_list> m_atlas_pages;       // glyph atlas pages by pixel height, newest last
+	std::map<atlas_key, atlas_glyph> m_atlas_glyphs;    // glyphs placed in the atlas
+	u32                 m_atlas_page_count; // total number of atlas pages
+
 	// constants
 	static const u64 CACHED_BDF_HASH_SIZE   = 1024;
+	static constexpr s32 ATLAS_PAGE_SIZE    = 512;
+	static constexpr s32 ATLAS_MAX_GLYPH    = ATLAS_PAGE_SIZE / 4;
+	static constexpr u32 ATLAS_MAX_PAGES    = 16;
 };
 
 std::string convert_command_glyph(std::string_view str);
@@ -1658,6 +1658,19 @@ void layout_element::preload()
 }
 
 
+//-------------------------------------------------
+//  preload_callback - work queue entry point for
+//  preloading one element on a worker thread
+//-------------------------------------------------
+
+void *layout_element::preload_callback(void *param, int threadid)
+{
+	// components only touch their own state while loading
+	(*reinterpret_cast<layout_element **>(param))->preload();
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  element_scale - scale an element by rendering
 //  all the components at the appropriate
@@ -4289,15 +4302,33 @@ void layout_view::set_recomputed_callback(recomputed_delegate &&handler)
 
 //-------------------------------------------------
 //  preload - perform expensive loading upfront
-//  for visible elements
+//  for visible elements, spreading them across a
+//  work queue if one is supplied
 //-------------------------------------------------
 
-void layout_view::preload()
+void layout_view::preload(osd_work_queue *queue)
 {
+	// the same element can back any number of items, so only load it once
+	std::vector<layout_element *> elements;
+	elements.reserve(m_visible_items.size());
 	for (item &curitem : m_visible_items)
 	{
 		if (curitem.element())
-			curitem.element()->preload();
+			elements.push_back(curitem.element());
+	}
+	std::sort(elements.begin(), elements.end());
+	elements.erase(std::unique(elements.begin(), elements.end()), elements.end());
+
+	// decoding artwork images dominates start-up time, so spread it across worker threads
+	if (queue && (1U < elements.size()))
+	{
+		osd_work_item_queue_multiple(queue, &layout_element::preload_callback, elements.size(), &elements[0], sizeof(elements[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second() * 10)) { }
+	}
+	else
+	{
+		for (layout_element *const element : elements)
+			element->preload();
 	}
 
 	if (!m_preload.isnull())
@@ -83,6 +83,7 @@ public:
 
 	// operations
 	void preload();
+	static void *preload_callback(void *param, int threadid);
 
 private:
 	/// \brief A drawing component within a layout element
@@ -523,7 +524,7 @@ public:
 	// operations
 	void prepare_items() { if (!m_prepare_items.isnull()) m_prepare_items(); }
 	void recompute(u32 visibility_mask, bool zoom_to_screens);
-	void preload();
+	void preload(osd_work_queue *queue = nullptr);
 
 	// resolve tags, if any
 	void resolve_tags();
@@ -555,6 +555,8 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_curbitmap(0)
 	, m_curtexture(0)
 	, m_changed(true)
+	, m_dirty_top{ 0, 0 }
+	, m_dirty_bottom{ -1, -1 }
 	, m_last_partial_scan(0)
 	, m_partial_scan_hpos(0)
 	, m_color(rgb_t(0xff, 0xff, 0xff, 0xff))
@@ -571,6 +573,10 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_scanline_timer(nullptr)
 	, m_frame_number(0)
 	, m_partial_updates_this_frame(0)
+	, m_update_queue(nullptr)
+	, m_pipeline_queue(nullptr)
+	, m_pipeline_item(nullptr)
+	, m_pipeline_flags(0)
 {
 	m_unique_id = m_id_counter;
 	m_id_counter++;
@@ -892,6 +898,15 @@ void screen_device::device_start()
 		logerror("%s: Deprecated legacy Old Style screen configured (MCFG_SCREEN_VBLANK_TIME), please use MCFG_SCREEN_RAW_PARAMS instead.\n",this->tag());
 
 	m_is_primary_screen = (this == screen_device_enumerator(machine().root_device()).first());
+
+	// drivers that declare their update thread-safe get a queue for banded updates
+	if ((m_video_attributes & VIDEO_UPDATE_THREADSAFE) && !(m_video_attributes & VIDEO_VARIABLE_WIDTH) && (m_type != SCREEN_TYPE_SVG))
+		m_update_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
+	// pipelined screens render whole frames on a worker during VBLANK, which only overlaps with emulation
+	// when the frame isn't needed until VBLANK ends; the debugger needs to see them synchronously
+	if ((m_video_attributes & VIDEO_UPDATE_PIPELINED) && (m_video_attributes & VIDEO_UPDATE_AFTER_VBLANK) && !(m_video_attributes & VIDEO_VARIABLE_WIDTH) && ((m_type == SCREEN_TYPE_RASTER) || (m_type == SCREEN_TYPE_LCD)) && !(machine().debug_flags & DEBUG_FLAG_ENABLED))
+		m_pipeline_queue = osd_work_queue_alloc(0);
 }
 
 
@@ -913,6 +928,17 @@ void screen_device::device_reset()
 
 void screen_device::device_stop()
 {
+	finish_pipelined_update();
+	if (m_pipeline_queue)
+	{
+		osd_work_queue_free(m_pipeline_queue);
+		m_pipeline_queue = nullptr;
+	}
+	if (m_update_queue)
+	{
+		osd_work_queue_free(m_update_queue);
+		m_update_queue = nullptr;
+	}
 	machine().render().texture_free(m_texture[0]);
 	machine().render().texture_free(m_texture[1]);
 	if (m_burnin.valid())
@@ -985,6 +1011,9 @@ void screen_device::configure(int width, int height, const rectangle &visarea, a
 	assert(m_type == SCREEN_TYPE_VECTOR || m_type == SCREEN_TYPE_SVG || visarea.top() < height);
 	assert(frame_period > 0);
 
+	// the bitmaps may be reallocated below
+	finish_pipelined_update();
+
 	// fill in the new parameters
 	m_max_width = std::max(m_max_width, width);
 	m_width = width;
@@ -1145,23 +1174,12 @@ bool screen_device::update_partial(int scanline)
 {
 	LOG_PARTIAL_UPDATES(("Partial: update_partial(%s, %d): ", tag(), scanline));
 
-	// these two checks only apply if we're allowed to skip frames
-	if (!(m_video_attributes & VIDEO_ALWAYS_UPDATE))
-	{
-		// if skipping this frame, bail
-		if (machine().video().skip_this_frame())
-		{
-			LOG_PARTIAL_UPDATES(("skipped due to frameskipping\n"));
-			return false;
-		}
+	// a frame rendered ahead must land before anything else is drawn
+	finish_pipelined_update();
 
-		// skip if this screen is not visible anywhere
-		if (!machine().render().is_live(*this))
-		{
-			LOG_PARTIAL_UPDATES(("skipped because screen not live\n"));
-			return false;
-		}
-	}
+	// frameskipping and screens that aren't visible anywhere
+	if (!update_allowed())
+		return false;
 
 	// skip if we already rendered this line
 	if (scanline < m_last_partial_scan)
@@ -1181,8 +1199,9 @@ bool screen_device::update_partial(int scanline)
 		return false;
 	}
 
-	// otherwise, render
+	// otherwise, render; batched palette changes are applied here rather than on worker threads
 	LOG_PARTIAL_UPDATES(("updating %d-%d\n", clip.top(), clip.bottom()));
+	apply_palette_changes();
 
 	u32 flags = 0;
 	{
@@ -1211,11 +1230,18 @@ bool screen_device::update_partial(int scanline)
 			if (m_type != SCREEN_TYPE_SVG)
 			{
 				screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
-				switch (curbitmap.format())
+				if (m_update_queue && (clip.height() >= 2 * MIN_UPDATE_BAND_HEIGHT) && !g_profiler.enabled())
 				{
-					default:
-					case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-					case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
+					flags = update_banded(curbitmap, clip);
+				}
+				else
+				{
+					switch (curbitmap.format())
+					{
+						default:
+						case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
+						case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
+					}
 				}
 			}
 			else
@@ -1228,7 +1254,7 @@ bool screen_device::update_partial(int scanline)
 	}
 
 	// if we modified the bitmap, we have to commit
-	m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+	note_update(flags, clip.top(), clip.bottom());
 
 	// remember where we left off
 	m_last_partial_scan = scanline + 1;
@@ -1237,6 +1263,185 @@ bool screen_device::update_partial(int scanline)
 }
 
 
+//-------------------------------------------------
+//  note_update - record the rows an update drew
+//  into the current bitmap, unless the driver
+//  reported that nothing changed
+//-------------------------------------------------
+
+void screen_device::note_update(u32 flags, int top, int bottom)
+{
+	if (flags & UPDATE_HAS_NOT_CHANGED)
+		return;
+
+	m_changed = true;
+	if (m_dirty_top[m_curbitmap] > m_dirty_bottom[m_curbitmap])
+	{
+		m_dirty_top[m_curbitmap] = top;
+		m_dirty_bottom[m_curbitmap] = bottom;
+	}
+	else
+	{
+		m_dirty_top[m_curbitmap] = (std::min)(m_dirty_top[m_curbitmap], top);
+		m_dirty_bottom[m_curbitmap] = (std::max)(m_dirty_bottom[m_curbitmap], bottom);
+	}
+}
+
+
+//-------------------------------------------------
+//  apply_palette_changes - bring the adjusted
+//  colors of every palette up to date before the
+//  update callback reads them; the callback may
+//  use any palette, not just ours
+//-------------------------------------------------
+
+void screen_device::apply_palette_changes()
+{
+	machine().video().apply_palette_changes();
+}
+
+
+//-------------------------------------------------
+//  update_allowed - return false if updates are
+//  currently suppressed by frameskipping or
+//  because the screen is not visible anywhere
+//-------------------------------------------------
+
+bool screen_device::update_allowed()
+{
+	// these two checks only apply if we're allowed to skip frames
+	if (!(m_video_attributes & VIDEO_ALWAYS_UPDATE))
+	{
+		// if skipping this frame, bail
+		if (machine().video().skip_this_frame())
+		{
+			LOG_PARTIAL_UPDATES(("skipped due to frameskipping\n"));
+			return false;
+		}
+
+		// skip if this screen is not visible anywhere
+		if (!machine().render().is_live(*this))
+		{
+			LOG_PARTIAL_UPDATES(("skipped because screen not live\n"));
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  start_pipelined_update - at VBLANK start,
+//  render the whole visible area on a worker
+//  thread while emulation carries on
+//-------------------------------------------------
+
+void screen_device::start_pipelined_update()
+{
+	// only whole frames that haven't been touched yet
+	if (m_last_partial_scan != 0 || m_partial_scan_hpos != 0 || g_profiler.enabled() || !update_allowed())
+		return;
+
+	LOG_PARTIAL_UPDATES(("Partial: pipelined update(%s) of %d-%d\n", tag(), m_visarea.top(), m_visarea.bottom()));
+	apply_palette_changes();
+	m_pipeline_flags = 0;
+	m_pipeline_item = osd_work_item_queue(m_pipeline_queue, pipelined_update_callback, this, 0);
+	if (!m_pipeline_item)
+		return;
+
+	// the frame is now accounted for, exactly as if update_partial had drawn it
+	m_partial_updates_this_frame++;
+	m_last_partial_scan = m_visarea.bottom() + 1;
+	m_partial_scan_hpos = 0;
+}
+
+
+//-------------------------------------------------
+//  join_pipelined_update - wait for the frame
+//  being rendered on the worker thread
+//-------------------------------------------------
+
+void screen_device::join_pipelined_update()
+{
+	osd_work_item_wait(m_pipeline_item, osd_ticks_per_second() * 100);
+	osd_work_item_release(m_pipeline_item);
+	m_pipeline_item = nullptr;
+
+	// if we modified the bitmap, we have to commit
+	note_update(m_pipeline_flags, m_visarea.top(), m_visarea.bottom());
+}
+
+
+//-------------------------------------------------
+//  pipelined_update_callback - worker thread side
+//  of a pipelined update
+//-------------------------------------------------
+
+void *screen_device::pipelined_update_callback(void *param, int threadid)
+{
+	screen_device &screen = *reinterpret_cast<screen_device *>(param);
+	screen_bitmap &curbitmap = screen.m_bitmap[screen.m_curbitmap];
+	device_palette_interface::reader_thread_scope const reader;
+	switch (curbitmap.format())
+	{
+		default:
+		case BITMAP_FORMAT_IND16:   screen.m_pipeline_flags = screen.m_screen_update_ind16(screen, curbitmap.as_ind16(), screen.m_visarea);   break;
+		case BITMAP_FORMAT_RGB32:   screen.m_pipeline_flags = screen.m_screen_update_rgb32(screen, curbitmap.as_rgb32(), screen.m_visarea);   break;
+	}
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  update_banded - split an update into
+//  horizontal bands and render them on the work
+//  queue, returning the combined update flags
+//-------------------------------------------------
+
+u32 screen_device::update_banded(screen_bitmap &curbitmap, const rectangle &clip)
+{
+	int const bands = (std::min)(MAX_UPDATE_BANDS, clip.height() / MIN_UPDATE_BAND_HEIGHT);
+	for (int band = 0; band < bands; band++)
+	{
+		update_band &item = m_update_bands[band];
+		item.screen = this;
+		item.bitmap = &curbitmap;
+		item.clip = clip;
+		item.clip.sety(clip.top() + clip.height() * band / bands, clip.top() + clip.height() * (band + 1) / bands - 1);
+		item.flags = 0;
+	}
+
+	osd_work_item_queue_multiple(m_update_queue, update_band_callback, bands, m_update_bands, sizeof(m_update_bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(m_update_queue, osd_ticks_per_second() * 100);
+
+	// the frame only counts as unchanged if every band says so
+	u32 flags = UPDATE_HAS_NOT_CHANGED;
+	for (int band = 0; band < bands; band++)
+		flags &= m_update_bands[band].flags;
+	return flags;
+}
+
+
+//-------------------------------------------------
+//  update_band_callback - render one band of a
+//  banded update
+//-------------------------------------------------
+
+void *screen_device::update_band_callback(void *param, int threadid)
+{
+	update_band &item = *reinterpret_cast<update_band *>(param);
+	screen_device &screen = *item.screen;
+	device_palette_interface::reader_thread_scope const reader;
+	switch (item.bitmap->format())
+	{
+		default:
+		case BITMAP_FORMAT_IND16:   item.flags = screen.m_screen_update_ind16(screen, item.bitmap->as_ind16(), item.clip);   break;
+		case BITMAP_FORMAT_RGB32:   item.flags = screen.m_screen_update_rgb32(screen, item.bitmap->as_rgb32(), item.clip);   break;
+	}
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  update_now - perform an update from the last
 //  beam position up to the current beam position
@@ -1244,6 +1449,8 @@ bool screen_device::update_partial(int scanline)
 
 void screen_device::update_now()
 {
+	finish_pipelined_update();
+
 	// these two checks only apply if we're allowed to skip frames
 	if (!(m_video_attributes & VIDEO_ALWAYS_UPDATE))
 	{
@@ -1298,6 +1505,7 @@ void screen_device::update_now()
 			if (!clip.empty())
 			{
 				auto profile = g_profiler.start(PROFILER_VIDEO);
+				apply_palette_changes();
 
 				u32 flags = 0;
 				screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
@@ -1324,7 +1532,7 @@ void screen_device::update_now()
 				m_partial_updates_this_frame++;
 
 				// if we modified the bitmap, we have to commit
-				m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+				note_update(flags, clip.top(), clip.bottom());
 			}
 
 			m_partial_scan_hpos = 0;
@@ -1352,6 +1560,7 @@ void screen_device::update_now()
 			auto profile = g_profiler.start(PROFILER_VIDEO);
 
 			LOG_PARTIAL_UPDATES(("doing scanline partial draw: Y %d X %d-%d\n", clip.bottom(), clip.left(), clip.right()));
+			apply_palette_changes();
 
 			u32 flags = 0;
 			screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
@@ -1378,7 +1587,7 @@ void screen_device::update_now()
 			m_partial_updates_this_frame++;
 
 			// if we modified the bitmap, we have to commit
-			m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+			note_update(flags, clip.top(), clip.bottom());
 		}
 	}
 
@@ -1395,6 +1604,7 @@ void screen_device::update_now()
 
 void screen_device::reset_partial_updates()
 {
+	finish_pipelined_update();
 	m_last_partial_scan = 0;
 	m_partial_scan_hpos = 0;
 	m_partial_updates_this_frame = 0;
@@ -1409,6 +1619,7 @@ void screen_device::reset_partial_updates()
 
 u32 screen_device::pixel(s32 x, s32 y)
 {
+	finish_pipelined_update();
 	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
 	if (!curbitmap.valid())
 		return 0;
@@ -1427,6 +1638,7 @@ u32 screen_device::pixel(s32 x, s32 y)
 		{
 			bitmap_ind16 &srcbitmap = per_scanline ? *(bitmap_ind16 *)m_scan_bitmaps[m_curbitmap][y] : curbitmap.as_ind16();
 			const u16 src = per_scanline ? srcbitmap.pix(0, x) : srcbitmap.pix(y, x);
+			machine().video().apply_palette_changes();
 			const rgb_t *palette = m_palette->palette()->entry_list_adjusted();
 			return (u32)palette[src];
 		}
@@ -1456,6 +1668,7 @@ u32 screen_device::pixel(s32 x, s32 y)
 
 void screen_device::pixels(u32 *buffer)
 {
+	finish_pipelined_update();
 	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
 	if (!curbitmap.valid())
 		return;
@@ -1468,6 +1681,7 @@ void screen_device::pixels(u32 *buffer)
 	{
 		case BITMAP_FORMAT_IND16:
 		{
+			machine().video().apply_palette_changes();
 			const rgb_t *palette = m_palette->palette()->entry_list_adjusted();
 			for (int y = visarea.min_y; y <= visarea.max_y; y++)
 			{
@@ -1650,6 +1864,10 @@ TIMER_CALLBACK_MEMBER(screen_device::vblank_begin)
 		item->m_callback(*this, true);
 	m_screen_vblank(1);
 
+	// drivers latch their state in the callbacks above; render the finished frame in the background until VBLANK ends
+	if (m_pipeline_queue)
+		start_pipelined_update();
+
 	// reset the VBLANK start timer for the next frame
 	m_vblank_begin_timer->adjust(time_until_vblank_start());
 
@@ -1741,6 +1959,9 @@ void screen_device::create_composited_bitmap()
 
 bool screen_device::update_quads()
 {
+	// make sure a frame rendered ahead has landed
+	finish_pipelined_update();
+
 	// only update if live
 	if (machine().render().is_live(*this))
 	{
@@ -1750,11 +1971,18 @@ bool screen_device::update_quads()
 			// if we're not skipping the frame and if the screen actually changed, then update the texture
 			if (!machine().video().skip_this_frame() && m_changed)
 			{
+				// only the rows drawn since this texture was last set need converting again
 				if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
 				{
 					create_composited_bitmap();
+					m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
 				}
-				m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
+				else
+				{
+					m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat(), m_dirty_top[m_curbitmap], m_dirty_bottom[m_curbitmap]);
+				}
+				m_dirty_top[m_curbitmap] = 0;
+				m_dirty_bottom[m_curbitmap] = -1;
 				m_curtexture = m_curbitmap;
 				m_curbitmap = 1 - m_curbitmap;
 			}
@@ -1807,6 +2035,8 @@ void screen_device::update_burnin()
 		default:
 		case BITMAP_FORMAT_IND16:
 		{
+			machine().video().apply_palette_changes();
+
 			// iterate over rows in the destination
 			for (int y = 0, srcy = ystart; y < dstheight; y++, srcy += ystep)
 			{
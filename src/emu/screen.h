@@ -60,6 +60,17 @@ constexpr u32 UPDATE_HAS_NOT_CHANGED = 0x0001;   // the video has not changed
  @def VIDEO_VARIABLE_WIDTH
  causes the screen to construct its final bitmap from a composite upscale of individual scanline bitmaps
 
+ @def VIDEO_UPDATE_THREADSAFE
+ declares that the screen update callback only touches state inside its cliprect, so large updates
+ may be split into horizontal bands rendered concurrently on worker threads
+
+ @def VIDEO_UPDATE_PIPELINED
+ declares that the screen is drawn once per frame without partial updates, and that the update
+ callback only reads state latched by the VBLANK start callbacks; the frame is then rendered on a
+ worker thread after those callbacks while emulation continues, and joined before the bitmap is
+ next used.  Only takes effect together with VIDEO_UPDATE_AFTER_VBLANK, since otherwise the frame
+ is needed straight away and nothing would overlap
+
  @}
  */
 
@@ -70,6 +81,8 @@ constexpr u32 VIDEO_SELF_RENDER             = 0x0008;
 constexpr u32 VIDEO_ALWAYS_UPDATE           = 0x0080;
 constexpr u32 VIDEO_UPDATE_SCANLINE         = 0x0100;
 constexpr u32 VIDEO_VARIABLE_WIDTH          = 0x0200;
+constexpr u32 VIDEO_UPDATE_THREADSAFE       = 0x0400;
+constexpr u32 VIDEO_UPDATE_PIPELINED        = 0x0800;
 
 
 //**************************************************************************
@@ -164,6 +177,7 @@ typedef device_delegate<u32 (screen_device &, bitmap_rgb32 &, const rectangle &)
 class screen_device : public device_t
 {
 	friend class render_manager;
+	friend class video_manager;
 
 public:
 	// construction/destruction
@@ -447,6 +461,26 @@ private:
 	void create_composited_bitmap();
 	void destroy_scan_bitmaps();
 	void allocate_scan_bitmaps();
+	u32 update_banded(screen_bitmap &curbitmap, const rectangle &clip);
+	static void *update_band_callback(void *param, int threadid);
+	bool update_allowed();
+	void note_update(u32 flags, int top, int bottom);
+	void apply_palette_changes();
+	void start_pipelined_update();
+	void finish_pipelined_update() { if (m_pipeline_item) join_pipelined_update(); }
+	void join_pipelined_update();
+	static void *pipelined_update_callback(void *param, int threadid);
+
+	// band-parallel updates
+	static constexpr int MAX_UPDATE_BANDS = 16;
+	static constexpr int MIN_UPDATE_BAND_HEIGHT = 16;
+	struct update_band
+	{
+		screen_device *     screen;                 // owning screen
+		screen_bitmap *     bitmap;                 // bitmap being rendered
+		rectangle           clip;                   // scanlines covered by this band
+		u32                 flags;                  // flags returned by the update callback
+	};
 
 	// inline configuration data
 	screen_type_enum    m_type;                     // type of screen
@@ -485,6 +519,8 @@ private:
 	u8                  m_curbitmap;                // current bitmap index
 	u8                  m_curtexture;               // current texture index
 	bool                m_changed;                  // has this bitmap changed?
+	s32                 m_dirty_top[2];             // first row drawn into each bitmap since its texture was last set
+	s32                 m_dirty_bottom[2];          // last row drawn into each bitmap since its texture was last set
 	s32                 m_last_partial_scan;        // scanline of last partial update
 	s32                 m_partial_scan_hpos;        // horizontal pixel last rendered on this partial scanline
 	bitmap_argb32       m_screen_overlay_bitmap;    // screen overlay bitmap
@@ -507,6 +543,11 @@ private:
 	u32                 m_partial_updates_this_frame;// partial update counter this frame
 
 	bool                m_is_primary_screen;
+	osd_work_queue *    m_update_queue;             // work queue for VIDEO_UPDATE_THREADSAFE screens
+	update_band         m_update_bands[MAX_UPDATE_BANDS]; // per-band parameters for the work queue
+	osd_work_queue *    m_pipeline_queue;           // work queue for VIDEO_UPDATE_PIPELINED screens
+	osd_work_item *     m_pipeline_item;            // frame currently being rendered, if any
+	u32                 m_pipeline_flags;           // flags returned by the pipelined update
 
 	// VBLANK callbacks
 	class callback_item
@@ -12,6 +12,7 @@
 #include "tilemap.h"
 
 #include "screen.h"
+#include "video/tilescan.h"
 
 
 //**************************************************************************
@@ -109,13 +110,7 @@ inline bool tilemap_t::gfx_elements_changed()
 
 inline void tilemap_t::scanline_draw_opaque_null(int count, u8 *pri, u32 pcode)
 {
-	// skip entirely if not changing priority
-	if (pcode == 0xff00)
-		return;
-
-	// update priority across the scanline
-	for (int i = 0; i < count; i++)
-		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	emu::tilescan::opaque_null(count, pri, pcode);
 }
 
 
@@ -126,18 +121,10 @@ inline void tilemap_t::scanline_draw_opaque_null(int count, u8 *pri, u32 pcode)
 
 inline void tilemap_t::scanline_draw_masked_null(const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode)
 {
-	// skip entirely if not changing priority
-	if (pcode == 0xff00)
-		return;
-
-	// update priority across the scanline, checking the mask
-	for (int i = 0; i < count; i++)
-		if ((maskptr[i] & mask) == value)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	emu::tilescan::masked_null(maskptr, mask, value, count, pri, pcode);
 }
 
 
-
 //-------------------------------------------------
 //  scanline_draw_opaque_ind16 - draw to a 16bpp
 //  indexed bitmap
@@ -145,38 +132,7 @@ inline void tilemap_t::scanline_draw_masked_null(const u8 *maskptr, int mask, in
 
 inline void tilemap_t::scanline_draw_opaque_ind16(u16 *dest, const u16 *source, int count, u8 *pri, u32 pcode)
 {
-	// special case for no palette offset
-	int pal = pcode >> 16;
-	if (pal == 0)
-	{
-		// use memcpy which should be well-optimized for the platform
-		memcpy(dest, source, count * 2);
-
-		// skip the rest if not changing priority
-		if (pcode == 0xff00)
-			return;
-
-		// update priority across the scanline
-		for (int i = 0; i < count; i++)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-	}
-
-	// priority case
-	else if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = source[i] + pal;
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			dest[i] = source[i] + pal;
-	}
+	emu::tilescan::opaque_ind16(dest, source, count, pri, pcode);
 }
 
 
@@ -187,30 +143,10 @@ inline void tilemap_t::scanline_draw_opaque_ind16(u16 *dest, const u16 *source,
 
 inline void tilemap_t::scanline_draw_masked_ind16(u16 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode)
 {
-	int pal = pcode >> 16;
-
-	// priority case
-	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = source[i] + pal;
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = source[i] + pal;
-	}
+	emu::tilescan::masked_ind16(dest, source, maskptr, mask, value, count, pri, pcode);
 }
 
 
-
 //-------------------------------------------------
 //  scanline_draw_opaque_rgb32 - draw to a 32bpp
 //  RGB bitmap
@@ -218,24 +154,7 @@ inline void tilemap_t::scanline_draw_masked_ind16(u16 *dest, const u16 *source,
 
 inline void tilemap_t::scanline_draw_opaque_rgb32(u32 *dest, const u16 *source, int count, const rgb_t *pens, u8 *pri, u32 pcode)
 {
-	const rgb_t *clut = &pens[pcode >> 16];
-
-	// priority case
-	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = clut[source[i]];
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			dest[i] = clut[source[i]];
-	}
+	emu::tilescan::opaque_rgb32(dest, source, count, pens, pri, pcode);
 }
 
 
@@ -246,26 +165,7 @@ inline void tilemap_t::scanline_draw_opaque_rgb32(u32 *dest, const u16 *source,
 
 inline void tilemap_t::scanline_draw_masked_rgb32(u32 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, const rgb_t *pens, u8 *pri, u32 pcode)
 {
-	const rgb_t *clut = &pens[pcode >> 16];
-
-	// priority case
-	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = clut[source[i]];
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = clut[source[i]];
-	}
+	emu::tilescan::masked_rgb32(dest, source, maskptr, mask, value, count, pens, pri, pcode);
 }
 
 
@@ -276,24 +176,7 @@ inline void tilemap_t::scanline_draw_masked_rgb32(u32 *dest, const u16 *source,
 
 inline void tilemap_t::scanline_draw_opaque_rgb32_alpha(u32 *dest, const u16 *source, int count, const rgb_t *pens, u8 *pri, u32 pcode, u8 alpha)
 {
-	const rgb_t *clut = &pens[pcode >> 16];
-
-	// priority case
-	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-	}
+	emu::tilescan::opaque_rgb32_alpha(dest, source, count, pens, pri, pcode, alpha);
 }
 
 
@@ -305,26 +188,7 @@ inline void tilemap_t::scanline_draw_opaque_rgb32_alpha(u32 *dest, const u16 *so
 
 inline void tilemap_t::scanline_draw_masked_rgb32_alpha(u32 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, const rgb_t *pens, u8 *pri, u32 pcode, u8 alpha)
 {
-	const rgb_t *clut = &pens[pcode >> 16];
-
-	// priority case
-	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-	}
+	emu::tilescan::masked_rgb32_alpha(dest, source, maskptr, mask, value, count, pens, pri, pcode, alpha);
 }
 
 
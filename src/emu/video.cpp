@@ -115,6 +115,7 @@ video_manager::video_manager(running_machine &machine)
 	, m_snap_native(true)
 	, m_snap_width(0)
 	, m_snap_height(0)
+	, m_snap_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ))
 {
 	// request a callback upon exiting
 	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&video_manager::exit, this));
@@ -123,6 +124,10 @@ video_manager::video_manager(running_machine &machine)
 	// extract initial execution state from global configuration settings
 	update_refresh_speed();
 
+	// remember every palette, so they can be brought up to date before screen updates
+	for (device_palette_interface &palette : palette_interface_enumerator(machine.root_device()))
+		m_palettes.push_back(&palette);
+
 	const unsigned screen_count(screen_device_enumerator(machine.root_device()).count());
 	const bool no_screens(!screen_count);
 
@@ -298,6 +303,31 @@ void video_manager::frame_update(bool from_debugger)
 }
 
 
+//-------------------------------------------------
+//  apply_palette_changes - recompute the batched
+//  changes to every palette; this must happen on
+//  the main thread, before any update that might
+//  read adjusted colors or pens starts
+//-------------------------------------------------
+
+void video_manager::apply_palette_changes()
+{
+	bool pending = false;
+	for (device_palette_interface *palette : m_palettes)
+		pending = pending || (palette->palette() && palette->palette()->pending());
+	if (!pending)
+		return;
+
+	// a pipelined update may still be reading the adjusted colors
+	for (screen_device &screen : screen_device_enumerator(machine().root_device()))
+		screen.finish_pipelined_update();
+
+	for (device_palette_interface *palette : m_palettes)
+		if (palette->palette())
+			palette->palette()->update();
+}
+
+
 //-------------------------------------------------
 //  speed_text - print the text to be displayed
 //  into a string buffer
@@ -335,6 +365,19 @@ std::string video_manager::speed_text()
 	if (partials > 1)
 		util::stream_format(str, "\n%d partial updates", partials);
 
+	// display movie writer backlog and how often it has held up emulation
+	if (is_recording())
+	{
+		int pending = 0;
+		u32 stalls = 0;
+		for (auto const &recording : m_movie_recordings)
+		{
+			pending += recording->pending_jobs();
+			stalls += recording->stalls();
+		}
+		util::stream_format(str, "\nrec %d queued, %u stalls", pending, stalls);
+	}
+
 	return str.str();
 }
 
@@ -360,9 +403,12 @@ void video_manager::save_snapshot(screen_device *screen, util::core_file &file)
 	pnginfo.add_text("System", text2);
 
 	// now do the actual work
+	apply_palette_changes();
 	const rgb_t *palette = (screen != nullptr && screen->has_palette()) ? screen->palette().palette()->entry_list_adjusted() : nullptr;
 	int entries = (screen != nullptr && screen->has_palette()) ? screen->palette().entries() : 0;
-	std::error_condition const error = util::png_write_bitmap(file, &pnginfo, m_snap_bitmap, entries, palette);
+	util::png_write_options options;
+	options.queue = m_snap_queue;
+	std::error_condition const error = util::png_write_bitmap(file, &pnginfo, m_snap_bitmap, entries, palette, options);
 	if (error)
 		osd_printf_error("Error generating PNG for snapshot (%s:%d %s)\n", error.category().name(), error.value(), error.message());
 }
@@ -521,6 +567,9 @@ void video_manager::exit()
 	// free the snapshot target
 	machine().render().target_free(m_snap_target);
 	m_snap_bitmap.reset();
+	if (m_snap_queue)
+		osd_work_queue_free(m_snap_queue);
+	m_snap_queue = nullptr;
 
 	// print a final result if we have at least 2 seconds' worth of data
 	if (!emulator_info::standalone() && m_overall_emutime.seconds() >= 1)
@@ -1118,9 +1167,9 @@ void video_manager::create_snapshot_bitmap(screen_device *screen)
 	render_primitive_list &primlist = m_snap_target->get_primitives();
 	primlist.acquire_lock();
 	if (machine().options().snap_bilinear())
-		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels(), m_snap_queue);
 	else
-		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels(), m_snap_queue);
 	primlist.release_lock();
 }
 
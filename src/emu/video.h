@@ -79,6 +79,9 @@ public:
 	// render a frame
 	void frame_update(bool from_debugger = false);
 
+	// palettes
+	void apply_palette_changes();
+
 	// current speed helpers
 	std::string speed_text();
 	double speed_percent() const { return m_speed_percent; }
@@ -174,6 +177,10 @@ private:
 	bool                m_snap_native;              // are we using native per-screen layouts?
 	s32                 m_snap_width;               // width of snapshots (0 == auto)
 	s32                 m_snap_height;              // height of snapshots (0 == auto)
+	osd_work_queue *    m_snap_queue;               // queue for drawing snapshot bands in parallel
+
+	// palettes whose batched changes are applied before screen updates
+	std::vector<device_palette_interface *> m_palettes;
 
 	// movie recordings
 	std::vector<movie_recording::ptr> m_movie_recordings;
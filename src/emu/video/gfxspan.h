@@ -0,0 +1,242 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    gfxspan.h
+
+    Span renderers for the common 8bpp gfx_element cases.  Each call
+    draws one clipped row; when 'flip' is set the source is walked
+    backwards from 'src'.  The generic versions behave exactly like
+    the per-pixel PIXEL_OP_*_TRANSPEN(_PRIORITY) operations; when SSE2
+    is available the unsuffixed entry points handle 16 pixels at a
+    time and fall back to the generic code for the remainder.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_GFXSPAN_H
+#define MAME_EMU_VIDEO_GFXSPAN_H
+
+#pragma once
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_GFXSPAN_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace emu::gfxspan {
+
+//**************************************************************************
+//  REFERENCE IMPLEMENTATIONS
+//**************************************************************************
+
+inline void transpen_rebase_generic(u16 *dest, const u8 *src, int count, bool flip, u32 color, u32 trans_pen)
+{
+	int const step = flip ? -1 : 1;
+	for (int i = 0; i < count; i++, src += step)
+		if (*src != trans_pen)
+			dest[i] = color + *src;
+}
+
+inline void transpen_remap_generic(u32 *dest, const u8 *src, int count, bool flip, const pen_t *paldata, u32 trans_pen)
+{
+	int const step = flip ? -1 : 1;
+	for (int i = 0; i < count; i++, src += step)
+		if (*src != trans_pen)
+			dest[i] = paldata[*src];
+}
+
+inline void prio_transpen_rebase_generic(u16 *dest, u8 *pri, const u8 *src, int count, bool flip, u32 color, u32 pmask, u32 trans_pen)
+{
+	int const step = flip ? -1 : 1;
+	for (int i = 0; i < count; i++, src += step)
+		if (*src != trans_pen)
+		{
+			if (((1 << (pri[i] & 0x1f)) & pmask) == 0)
+				dest[i] = color + *src;
+			pri[i] = 31;
+		}
+}
+
+inline void prio_transpen_remap_generic(u32 *dest, u8 *pri, const u8 *src, int count, bool flip, const pen_t *paldata, u32 pmask, u32 trans_pen)
+{
+	int const step = flip ? -1 : 1;
+	for (int i = 0; i < count; i++, src += step)
+		if (*src != trans_pen)
+		{
+			if (((1 << (pri[i] & 0x1f)) & pmask) == 0)
+				dest[i] = paldata[*src];
+			pri[i] = 31;
+		}
+}
+
+
+#ifdef MAME_GFXSPAN_SSE2
+
+//**************************************************************************
+//  SSE2 IMPLEMENTATIONS
+//**************************************************************************
+
+namespace detail {
+
+// 16 source pixels in destination order
+inline __m128i load_source(const u8 *src, int offset, bool flip)
+{
+	if (!flip)
+		return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + offset));
+
+	// reverse the bytes: dwords, then words within dwords, then bytes within words
+	__m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src - offset - 15));
+	s = _mm_shuffle_epi32(s, _MM_SHUFFLE(0, 1, 2, 3));
+	s = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+	return _mm_or_si128(_mm_slli_epi16(s, 8), _mm_srli_epi16(s, 8));
+}
+
+inline __m128i select(__m128i sel, __m128i a, __m128i b)
+{
+	return _mm_or_si128(_mm_and_si128(sel, a), _mm_andnot_si128(sel, b));
+}
+
+// per-byte 0xff where ((1 << (pri & 0x1f)) & pmask) == 0
+class priority_test
+{
+public:
+	priority_test(u32 pmask)
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			m_index[i] = _mm_set1_epi8(char(i));
+			m_bit[i] = _mm_set1_epi8(char(1 << i));
+		}
+		for (int i = 0; i < 4; i++)
+			m_maskbyte[i] = _mm_set1_epi8(char(pmask >> (i * 8)));
+	}
+
+	__m128i operator()(__m128i pri) const
+	{
+		__m128i const low = _mm_and_si128(pri, _mm_set1_epi8(0x07));
+		__m128i const high = _mm_and_si128(_mm_srli_epi16(pri, 3), _mm_set1_epi8(0x03));
+		__m128i bit = _mm_setzero_si128();
+		for (int i = 0; i < 8; i++)
+			bit = _mm_or_si128(bit, _mm_and_si128(_mm_cmpeq_epi8(low, m_index[i]), m_bit[i]));
+		__m128i maskbyte = _mm_setzero_si128();
+		for (int i = 0; i < 4; i++)
+			maskbyte = _mm_or_si128(maskbyte, _mm_and_si128(_mm_cmpeq_epi8(high, m_index[i]), m_maskbyte[i]));
+		return _mm_cmpeq_epi8(_mm_and_si128(bit, maskbyte), _mm_setzero_si128());
+	}
+
+private:
+	__m128i m_index[8];
+	__m128i m_bit[8];
+	__m128i m_maskbyte[4];
+};
+
+inline void store_rebase16(u16 *dest, __m128i src, __m128i draw, __m128i color)
+{
+	__m128i const zero = _mm_setzero_si128();
+	__m128i *const d = reinterpret_cast<__m128i *>(dest);
+	__m128i const lo = _mm_add_epi16(_mm_unpacklo_epi8(src, zero), color);
+	__m128i const hi = _mm_add_epi16(_mm_unpackhi_epi8(src, zero), color);
+	_mm_storeu_si128(d, select(_mm_unpacklo_epi8(draw, draw), lo, _mm_loadu_si128(d)));
+	_mm_storeu_si128(d + 1, select(_mm_unpackhi_epi8(draw, draw), hi, _mm_loadu_si128(d + 1)));
+}
+
+inline void store_remap16(u32 *dest, const u8 *src, int offset, bool flip, int bits, const pen_t *paldata)
+{
+	int const step = flip ? -1 : 1;
+	src += flip ? -offset : offset;
+	for (int i = 0; bits != 0; bits >>= 1, i++)
+		if (bits & 1)
+			dest[i] = paldata[src[i * step]];
+}
+
+} // namespace detail
+
+
+inline void transpen_rebase(u16 *dest, const u8 *src, int count, bool flip, u32 color, u32 trans_pen)
+{
+	__m128i const trans = _mm_set1_epi8(char(trans_pen));
+	__m128i const vcolor = _mm_set1_epi16(short(color));
+	int i = 0;
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i const s = detail::load_source(src, i, flip);
+		__m128i const draw = _mm_andnot_si128(_mm_cmpeq_epi8(s, trans), _mm_set1_epi8(char(0xff)));
+		if (_mm_movemask_epi8(draw) != 0)
+			detail::store_rebase16(&dest[i], s, draw, vcolor);
+	}
+	transpen_rebase_generic(&dest[i], flip ? (src - i) : (src + i), count - i, flip, color, trans_pen);
+}
+
+inline void transpen_remap(u32 *dest, const u8 *src, int count, bool flip, const pen_t *paldata, u32 trans_pen)
+{
+	__m128i const trans = _mm_set1_epi8(char(trans_pen));
+	int i = 0;
+	for ( ; i + 16 <= count; i += 16)
+	{
+		int const bits = ~_mm_movemask_epi8(_mm_cmpeq_epi8(detail::load_source(src, i, flip), trans)) & 0xffff;
+		if (bits != 0)
+			detail::store_remap16(&dest[i], src, i, flip, bits, paldata);
+	}
+	transpen_remap_generic(&dest[i], flip ? (src - i) : (src + i), count - i, flip, paldata, trans_pen);
+}
+
+inline void prio_transpen_rebase(u16 *dest, u8 *pri, const u8 *src, int count, bool flip, u32 color, u32 pmask, u32 trans_pen)
+{
+	detail::priority_test const test(pmask);
+	__m128i const trans = _mm_set1_epi8(char(trans_pen));
+	__m128i const vcolor = _mm_set1_epi16(short(color));
+	__m128i const top = _mm_set1_epi8(31);
+	int i = 0;
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i const s = detail::load_source(src, i, flip);
+		__m128i const opaque = _mm_andnot_si128(_mm_cmpeq_epi8(s, trans), _mm_set1_epi8(char(0xff)));
+		if (_mm_movemask_epi8(opaque) == 0)
+			continue;
+
+		__m128i *const p = reinterpret_cast<__m128i *>(&pri[i]);
+		__m128i const oldpri = _mm_loadu_si128(p);
+		__m128i const draw = _mm_and_si128(opaque, test(oldpri));
+		if (_mm_movemask_epi8(draw) != 0)
+			detail::store_rebase16(&dest[i], s, draw, vcolor);
+		_mm_storeu_si128(p, detail::select(opaque, top, oldpri));
+	}
+	prio_transpen_rebase_generic(&dest[i], &pri[i], flip ? (src - i) : (src + i), count - i, flip, color, pmask, trans_pen);
+}
+
+inline void prio_transpen_remap(u32 *dest, u8 *pri, const u8 *src, int count, bool flip, const pen_t *paldata, u32 pmask, u32 trans_pen)
+{
+	detail::priority_test const test(pmask);
+	__m128i const trans = _mm_set1_epi8(char(trans_pen));
+	__m128i const top = _mm_set1_epi8(31);
+	int i = 0;
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i const s = detail::load_source(src, i, flip);
+		__m128i const opaque = _mm_andnot_si128(_mm_cmpeq_epi8(s, trans), _mm_set1_epi8(char(0xff)));
+		if (_mm_movemask_epi8(opaque) == 0)
+			continue;
+
+		__m128i *const p = reinterpret_cast<__m128i *>(&pri[i]);
+		__m128i const oldpri = _mm_loadu_si128(p);
+		int const bits = _mm_movemask_epi8(_mm_and_si128(opaque, test(oldpri)));
+		if (bits != 0)
+			detail::store_remap16(&dest[i], src, i, flip, bits, paldata);
+		_mm_storeu_si128(p, detail::select(opaque, top, oldpri));
+	}
+	prio_transpen_remap_generic(&dest[i], &pri[i], flip ? (src - i) : (src + i), count - i, flip, paldata, pmask, trans_pen);
+}
+
+#else // MAME_GFXSPAN_SSE2
+
+inline void transpen_rebase(u16 *dest, const u8 *src, int count, bool flip, u32 color, u32 trans_pen) { transpen_rebase_generic(dest, src, count, flip, color, trans_pen); }
+inline void transpen_remap(u32 *dest, const u8 *src, int count, bool flip, const pen_t *paldata, u32 trans_pen) { transpen_remap_generic(dest, src, count, flip, paldata, trans_pen); }
+inline void prio_transpen_rebase(u16 *dest, u8 *pri, const u8 *src, int count, bool flip, u32 color, u32 pmask, u32 trans_pen) { prio_transpen_rebase_generic(dest, pri, src, count, flip, color, pmask, trans_pen); }
+inline void prio_transpen_remap(u32 *dest, u8 *pri, const u8 *src, int count, bool flip, const pen_t *paldata, u32 pmask, u32 trans_pen) { prio_transpen_remap_generic(dest, pri, src, count, flip, paldata, pmask, trans_pen); }
+
+#endif // MAME_GFXSPAN_SSE2
+
+} // namespace emu::gfxspan
+
+#endif // MAME_EMU_VIDEO_GFXSPAN_H
@@ -29,4 +29,7 @@
 
 #endif
 
+// row helpers, using AVX2 where the host supports it
+#include "rgbwide.h"
+
 #endif // MAME_EMU_VIDEO_RGBUTIL_H
@@ -0,0 +1,194 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    rgbwide.cpp
+
+    RGB span helpers with a run-time selected AVX2 implementation.
+
+    The AVX2 functions are compiled with a per-function target attribute
+    so the rest of the build keeps its baseline instruction set; they
+    are only called after the CPU has been checked.  Compilers without
+    the attribute (e.g. MSVC) always use the rgbaint_t implementation.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "rgbutil.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MAME_RGB_WIDE_AVX2
+#include <immintrin.h>
+#endif
+
+
+namespace {
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+using blend_span_func = void (*)(u32 *dest, const u32 *src, const u32 *other, int count, u8 factor);
+using scale_span_func = void (*)(u32 *dest, const u32 *src, int count, const rgbaint_t &scale);
+using scale_add_span_func = void (*)(u32 *dest, const u32 *src, int count, const rgbaint_t &scale, const rgbaint_t &add);
+
+struct span_functions
+{
+	blend_span_func     blend;
+	scale_span_func     scale;
+	scale_add_span_func scale_add;
+	bool                avx2;
+};
+
+
+/***************************************************************************
+    RGBAINT_T IMPLEMENTATION
+***************************************************************************/
+
+void blend_span_rgbaint(u32 *dest, const u32 *src, const u32 *other, int count, u8 factor)
+{
+	for (int i = 0; i < count; i++)
+	{
+		rgbaint_t s(src[i]);
+		s.blend(rgbaint_t(other[i]), factor);
+		dest[i] = s.to_rgba();
+	}
+}
+
+void scale_span_rgbaint(u32 *dest, const u32 *src, int count, const rgbaint_t &scale)
+{
+	for (int i = 0; i < count; i++)
+	{
+		rgbaint_t s(src[i]);
+		s.scale_and_clamp(scale);
+		dest[i] = s.to_rgba();
+	}
+}
+
+void scale_add_span_rgbaint(u32 *dest, const u32 *src, int count, const rgbaint_t &scale, const rgbaint_t &add)
+{
+	for (int i = 0; i < count; i++)
+	{
+		rgbaint_t s(src[i]);
+		s.scale_add_and_clamp(scale, add);
+		dest[i] = s.to_rgba();
+	}
+}
+
+
+/***************************************************************************
+    AVX2 IMPLEMENTATION
+***************************************************************************/
+
+#ifdef MAME_RGB_WIDE_AVX2
+
+#define AVX2_TARGET __attribute__((target("avx2")))
+
+// widen two adjacent pixels to eight 32-bit lanes, B G R A B G R A
+AVX2_TARGET inline __m256i load_pair(const u32 *src)
+{
+	return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src)));
+}
+
+// saturate both pixels back to bytes and store them, as rgbaint_t::to_rgba does
+AVX2_TARGET inline void store_pair(u32 *dest, __m256i value)
+{
+	__m256i const packed = _mm256_packus_epi16(_mm256_packs_epi32(value, _mm256_setzero_si256()), _mm256_setzero_si256());
+	_mm_storel_epi64(reinterpret_cast<__m128i *>(dest), _mm_unpacklo_epi32(_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 1)));
+}
+
+// the same rgbaint_t in both halves of a register
+AVX2_TARGET inline __m256i broadcast(const rgbaint_t &value)
+{
+	return _mm256_setr_epi32(
+			value.get_b32(), value.get_g32(), value.get_r32(), value.get_a32(),
+			value.get_b32(), value.get_g32(), value.get_r32(), value.get_a32());
+}
+
+AVX2_TARGET void blend_span_avx2(u32 *dest, const u32 *src, const u32 *other, int count, u8 factor)
+{
+	__m256i const scale1 = _mm256_set1_epi32(factor);
+	__m256i const scale2 = _mm256_set1_epi32(0x100 - factor);
+	int i = 0;
+	for ( ; i + 2 <= count; i += 2)
+	{
+		__m256i const s = _mm256_mullo_epi32(load_pair(&src[i]), scale1);
+		__m256i const o = _mm256_mullo_epi32(load_pair(&other[i]), scale2);
+		store_pair(&dest[i], _mm256_srai_epi32(_mm256_add_epi32(s, o), 8));
+	}
+	if (i < count)
+		blend_span_rgbaint(&dest[i], &src[i], &other[i], count - i, factor);
+}
+
+// clamping to 0-255 is left to the saturating packs in store_pair
+AVX2_TARGET void scale_span_avx2(u32 *dest, const u32 *src, int count, const rgbaint_t &scale)
+{
+	__m256i const wscale = broadcast(scale);
+	int i = 0;
+	for ( ; i + 2 <= count; i += 2)
+		store_pair(&dest[i], _mm256_srai_epi32(_mm256_mullo_epi32(load_pair(&src[i]), wscale), 8));
+	if (i < count)
+		scale_span_rgbaint(&dest[i], &src[i], count - i, scale);
+}
+
+AVX2_TARGET void scale_add_span_avx2(u32 *dest, const u32 *src, int count, const rgbaint_t &scale, const rgbaint_t &add)
+{
+	__m256i const wscale = broadcast(scale);
+	__m256i const wadd = broadcast(add);
+	int i = 0;
+	for ( ; i + 2 <= count; i += 2)
+		store_pair(&dest[i], _mm256_add_epi32(_mm256_srai_epi32(_mm256_mullo_epi32(load_pair(&src[i]), wscale), 8), wadd));
+	if (i < count)
+		scale_add_span_rgbaint(&dest[i], &src[i], count - i, scale, add);
+}
+
+#endif // MAME_RGB_WIDE_AVX2
+
+
+/***************************************************************************
+    DISPATCH
+***************************************************************************/
+
+span_functions pick_span_functions()
+{
+#ifdef MAME_RGB_WIDE_AVX2
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return span_functions{ &blend_span_avx2, &scale_span_avx2, &scale_add_span_avx2, true };
+#endif
+	return span_functions{ &blend_span_rgbaint, &scale_span_rgbaint, &scale_add_span_rgbaint, false };
+}
+
+inline span_functions const &host_span_functions()
+{
+	static span_functions const functions = pick_span_functions();
+	return functions;
+}
+
+} // anonymous namespace
+
+
+
+/***************************************************************************
+    SPAN HELPERS
+***************************************************************************/
+
+void rgb_blend_span(u32 *dest, const u32 *src, const u32 *other, int count, u8 factor)
+{
+	host_span_functions().blend(dest, src, other, count, factor);
+}
+
+void rgb_scale_span(u32 *dest, const u32 *src, int count, const rgbaint_t &scale)
+{
+	host_span_functions().scale(dest, src, count, scale);
+}
+
+void rgb_scale_add_span(u32 *dest, const u32 *src, int count, const rgbaint_t &scale, const rgbaint_t &add)
+{
+	host_span_functions().scale_add(dest, src, count, scale, add);
+}
+
+bool rgb_wide_avx2_active()
+{
+	return host_span_functions().avx2;
+}
@@ -0,0 +1,40 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    rgbwide.h
+
+    Span helpers that apply rgbaint_t operations to rows of packed
+    32-bit pixels.  Every helper gives the same per-pixel result as the
+    matching rgbaint_t operation followed by to_rgba().
+
+    On x86 hosts the implementation is picked once at run time: CPUs
+    with AVX2 process two pixels per 256-bit operation, everything else
+    uses rgbaint_t one pixel at a time.  The build itself does not need
+    to target AVX2.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_RGBWIDE_H
+#define MAME_EMU_VIDEO_RGBWIDE_H
+
+#pragma once
+
+
+/***************************************************************************
+    FUNCTION PROTOTYPES
+***************************************************************************/
+
+// dest[i] = src[i] * factor + other[i] * (256 - factor), like rgbaint_t::blend
+void rgb_blend_span(u32 *dest, const u32 *src, const u32 *other, int count, u8 factor);
+
+// dest[i] = clamp(src[i] * scale >> 8), like rgbaint_t::scale_and_clamp
+void rgb_scale_span(u32 *dest, const u32 *src, int count, const rgbaint_t &scale);
+
+// dest[i] = clamp((src[i] * scale >> 8) + add), like rgbaint_t::scale_add_and_clamp
+void rgb_scale_add_span(u32 *dest, const u32 *src, int count, const rgbaint_t &scale, const rgbaint_t &add);
+
+// true if the span helpers are using the AVX2 implementation
+bool rgb_wide_avx2_active();
+
+#endif // MAME_EMU_VIDEO_RGBWIDE_H
@@ -0,0 +1,499 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    tilescan.h
+
+    Scanline rasterizers used by the tilemap system.  The generic
+    versions are the reference implementations; when SSE2 is available
+    the unsuffixed entry points process 16 pixels at a time and fall
+    back to the reference code for the remainder.
+
+    Priority codes are packed as in tilemap_t: bits 0-7 are ORed into
+    the priority bitmap, bits 8-15 are ANDed with it first, and bits
+    16 and up are the palette offset.  A low word of 0xff00 leaves the
+    priority bitmap untouched.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_TILESCAN_H
+#define MAME_EMU_VIDEO_TILESCAN_H
+
+#pragma once
+
+#include "palette.h"
+
+#include <cstring>
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_TILESCAN_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace emu::tilescan {
+
+//**************************************************************************
+//  REFERENCE IMPLEMENTATIONS
+//**************************************************************************
+
+// same arithmetic as alpha_blend_r32
+constexpr u32 blend(u32 d, u32 s, u8 level)
+{
+	return ((((s & 0x0000ff) * level + (d & 0x0000ff) * int(256 - level)) >> 8)) |
+			((((s & 0x00ff00) * level + (d & 0x00ff00) * int(256 - level)) >> 8) & 0x00ff00) |
+			((((s & 0xff0000) * level + (d & 0xff0000) * int(256 - level)) >> 8) & 0xff0000);
+}
+
+inline void opaque_null_generic(int count, u8 *pri, u32 pcode)
+{
+	// skip entirely if not changing priority
+	if (pcode == 0xff00)
+		return;
+
+	// update priority across the scanline
+	for (int i = 0; i < count; i++)
+		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+}
+
+inline void masked_null_generic(const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode)
+{
+	// skip entirely if not changing priority
+	if (pcode == 0xff00)
+		return;
+
+	// update priority across the scanline, checking the mask
+	for (int i = 0; i < count; i++)
+		if ((maskptr[i] & mask) == value)
+			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+}
+
+inline void opaque_ind16_generic(u16 *dest, const u16 *source, int count, u8 *pri, u32 pcode)
+{
+	// special case for no palette offset
+	int pal = pcode >> 16;
+	if (pal == 0)
+	{
+		// use memcpy which should be well-optimized for the platform
+		memcpy(dest, source, count * 2);
+
+		// skip the rest if not changing priority
+		if (pcode == 0xff00)
+			return;
+
+		// update priority across the scanline
+		for (int i = 0; i < count; i++)
+			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	}
+
+	// priority case
+	else if ((pcode & 0xffff) != 0xff00)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			dest[i] = source[i] + pal;
+			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+		}
+	}
+
+	// no priority case
+	else
+	{
+		for (int i = 0; i < count; i++)
+			dest[i] = source[i] + pal;
+	}
+}
+
+inline void masked_ind16_generic(u16 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode)
+{
+	int pal = pcode >> 16;
+
+	// priority case
+	if ((pcode & 0xffff) != 0xff00)
+	{
+		for (int i = 0; i < count; i++)
+			if ((maskptr[i] & mask) == value)
+			{
+				dest[i] = source[i] + pal;
+				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+			}
+	}
+
+	// no priority case
+	else
+	{
+		for (int i = 0; i < count; i++)
+			if ((maskptr[i] & mask) == value)
+				dest[i] = source[i] + pal;
+	}
+}
+
+inline void opaque_rgb32_generic(u32 *dest, const u16 *source, int count, const rgb_t *pens, u8 *pri, u32 pcode)
+{
+	const rgb_t *clut = &pens[pcode >> 16];
+
+	// priority case
+	if ((pcode & 0xffff) != 0xff00)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			dest[i] = clut[source[i]];
+			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+		}
+	}
+
+	// no priority case
+	else
+	{
+		for (int i = 0; i < count; i++)
+			dest[i] = clut[source[i]];
+	}
+}
+
+inline void masked_rgb32_generic(u32 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, const rgb_t *pens, u8 *pri, u32 pcode)
+{
+	const rgb_t *clut = &pens[pcode >> 16];
+
+	// priority case
+	if ((pcode & 0xffff) != 0xff00)
+	{
+		for (int i = 0; i < count; i++)
+			if ((maskptr[i] & mask) == value)
+			{
+				dest[i] = clut[source[i]];
+				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+			}
+	}
+
+	// no priority case
+	else
+	{
+		for (int i = 0; i < count; i++)
+			if ((maskptr[i] & mask) == value)
+				dest[i] = clut[source[i]];
+	}
+}
+
+inline void opaque_rgb32_alpha_generic(u32 *dest, const u16 *source, int count, const rgb_t *pens, u8 *pri, u32 pcode, u8 alpha)
+{
+	const rgb_t *clut = &pens[pcode >> 16];
+
+	// priority case
+	if ((pcode & 0xffff) != 0xff00)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			dest[i] = blend(dest[i], clut[source[i]], alpha);
+			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+		}
+	}
+
+	// no priority case
+	else
+	{
+		for (int i = 0; i < count; i++)
+			dest[i] = blend(dest[i], clut[source[i]], alpha);
+	}
+}
+
+inline void masked_rgb32_alpha_generic(u32 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, const rgb_t *pens, u8 *pri, u32 pcode, u8 alpha)
+{
+	const rgb_t *clut = &pens[pcode >> 16];
+
+	// priority case
+	if ((pcode & 0xffff) != 0xff00)
+	{
+		for (int i = 0; i < count; i++)
+			if ((maskptr[i] & mask) == value)
+			{
+				dest[i] = blend(dest[i], clut[source[i]], alpha);
+				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+			}
+	}
+
+	// no priority case
+	else
+	{
+		for (int i = 0; i < count; i++)
+			if ((maskptr[i] & mask) == value)
+				dest[i] = blend(dest[i], clut[source[i]], alpha);
+	}
+}
+
+
+#ifdef MAME_TILESCAN_SSE2
+
+//**************************************************************************
+//  SSE2 IMPLEMENTATIONS
+//**************************************************************************
+
+namespace detail {
+
+// a mask/value pair that can never match leaves the scanline alone; the
+// vector comparison only sees the low eight bits, so filter those out
+inline bool mask_can_match(int mask, int value)
+{
+	return !(value & ~(mask & 0xff));
+}
+
+// per-byte 0xff where (maskptr[i] & mask) == value
+inline __m128i mask_match(const u8 *maskptr, __m128i vmask, __m128i vvalue)
+{
+	__m128i const m = _mm_loadu_si128(reinterpret_cast<const __m128i *>(maskptr));
+	return _mm_cmpeq_epi8(_mm_and_si128(m, vmask), vvalue);
+}
+
+inline __m128i priority_update(__m128i p, __m128i pand, __m128i por)
+{
+	return _mm_or_si128(_mm_and_si128(p, pand), por);
+}
+
+inline __m128i select(__m128i sel, __m128i a, __m128i b)
+{
+	return _mm_or_si128(_mm_and_si128(sel, a), _mm_andnot_si128(sel, b));
+}
+
+inline __m128i lookup4(const rgb_t *clut, const u16 *source)
+{
+	return _mm_set_epi32(u32(clut[source[3]]), u32(clut[source[2]]), u32(clut[source[1]]), u32(clut[source[0]]));
+}
+
+// four pixels at once, matching blend() bit for bit
+inline __m128i blend4(__m128i d, __m128i s, __m128i slevel, __m128i dlevel)
+{
+	__m128i const zero = _mm_setzero_si128();
+	__m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), slevel), _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), dlevel));
+	__m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), slevel), _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), dlevel));
+	lo = _mm_srli_epi16(lo, 8);
+	hi = _mm_srli_epi16(hi, 8);
+	return _mm_and_si128(_mm_packus_epi16(lo, hi), _mm_set1_epi32(0x00ffffff));
+}
+
+inline void update_priority16(u8 *pri, __m128i pand, __m128i por)
+{
+	__m128i *const p = reinterpret_cast<__m128i *>(pri);
+	_mm_storeu_si128(p, priority_update(_mm_loadu_si128(p), pand, por));
+}
+
+inline void update_priority16(u8 *pri, __m128i sel, __m128i pand, __m128i por)
+{
+	__m128i *const p = reinterpret_cast<__m128i *>(pri);
+	__m128i const old = _mm_loadu_si128(p);
+	_mm_storeu_si128(p, select(sel, priority_update(old, pand, por), old));
+}
+
+} // namespace detail
+
+
+inline void opaque_null(int count, u8 *pri, u32 pcode)
+{
+	if (pcode == 0xff00)
+		return;
+
+	__m128i const pand = _mm_set1_epi8(char(pcode >> 8));
+	__m128i const por = _mm_set1_epi8(char(pcode));
+	int i = 0;
+	for ( ; i + 16 <= count; i += 16)
+		detail::update_priority16(&pri[i], pand, por);
+	opaque_null_generic(count - i, &pri[i], pcode);
+}
+
+inline void masked_null(const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode)
+{
+	if (pcode == 0xff00 || !detail::mask_can_match(mask, value))
+		return;
+
+	__m128i const vmask = _mm_set1_epi8(char(mask));
+	__m128i const vvalue = _mm_set1_epi8(char(value));
+	__m128i const pand = _mm_set1_epi8(char(pcode >> 8));
+	__m128i const por = _mm_set1_epi8(char(pcode));
+	int i = 0;
+	for ( ; i + 16 <= count; i += 16)
+		detail::update_priority16(&pri[i], detail::mask_match(&maskptr[i], vmask, vvalue), pand, por);
+	masked_null_generic(&maskptr[i], mask, value, count - i, &pri[i], pcode);
+}
+
+inline void opaque_ind16(u16 *dest, const u16 *source, int count, u8 *pri, u32 pcode)
+{
+	bool const setpri = (pcode & 0xffff) != 0xff00;
+	__m128i const pal = _mm_set1_epi16(short(pcode >> 16));
+	__m128i const pand = _mm_set1_epi8(char(pcode >> 8));
+	__m128i const por = _mm_set1_epi8(char(pcode));
+	int i = 0;
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i const s0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i]));
+		__m128i const s1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i + 8]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), _mm_add_epi16(s0, pal));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i + 8]), _mm_add_epi16(s1, pal));
+		if (setpri)
+			detail::update_priority16(&pri[i], pand, por);
+	}
+	opaque_ind16_generic(&dest[i], &source[i], count - i, &pri[i], pcode);
+}
+
+inline void masked_ind16(u16 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode)
+{
+	if (!detail::mask_can_match(mask, value))
+		return;
+
+	bool const setpri = (pcode & 0xffff) != 0xff00;
+	__m128i const vmask = _mm_set1_epi8(char(mask));
+	__m128i const vvalue = _mm_set1_epi8(char(value));
+	__m128i const pal = _mm_set1_epi16(short(pcode >> 16));
+	__m128i const pand = _mm_set1_epi8(char(pcode >> 8));
+	__m128i const por = _mm_set1_epi8(char(pcode));
+	int i = 0;
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i const sel = detail::mask_match(&maskptr[i], vmask, vvalue);
+		int const bits = _mm_movemask_epi8(sel);
+		if (bits == 0)
+			continue;
+
+		__m128i *const d = reinterpret_cast<__m128i *>(&dest[i]);
+		__m128i const s0 = _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i])), pal);
+		__m128i const s1 = _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i + 8])), pal);
+		if (bits == 0xffff)
+		{
+			_mm_storeu_si128(d, s0);
+			_mm_storeu_si128(d + 1, s1);
+			if (setpri)
+				detail::update_priority16(&pri[i], pand, por);
+		}
+		else
+		{
+			_mm_storeu_si128(d, detail::select(_mm_unpacklo_epi8(sel, sel), s0, _mm_loadu_si128(d)));
+			_mm_storeu_si128(d + 1, detail::select(_mm_unpackhi_epi8(sel, sel), s1, _mm_loadu_si128(d + 1)));
+			if (setpri)
+				detail::update_priority16(&pri[i], sel, pand, por);
+		}
+	}
+	masked_ind16_generic(&dest[i], &source[i], &maskptr[i], mask, value, count - i, &pri[i], pcode);
+}
+
+inline void opaque_rgb32(u32 *dest, const u16 *source, int count, const rgb_t *pens, u8 *pri, u32 pcode)
+{
+	// the palette lookup has no useful vector form; just do the priority side in bulk
+	opaque_rgb32_generic(dest, source, count, pens, pri, (pcode & ~0xffff) | 0xff00);
+	opaque_null(count, pri, pcode & 0xffff);
+}
+
+inline void masked_rgb32(u32 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, const rgb_t *pens, u8 *pri, u32 pcode)
+{
+	if (!detail::mask_can_match(mask, value))
+		return;
+
+	const rgb_t *clut = &pens[pcode >> 16];
+	bool const setpri = (pcode & 0xffff) != 0xff00;
+	__m128i const vmask = _mm_set1_epi8(char(mask));
+	__m128i const vvalue = _mm_set1_epi8(char(value));
+	__m128i const pand = _mm_set1_epi8(char(pcode >> 8));
+	__m128i const por = _mm_set1_epi8(char(pcode));
+	int i = 0;
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i const sel = detail::mask_match(&maskptr[i], vmask, vvalue);
+		int bits = _mm_movemask_epi8(sel);
+		if (bits == 0)
+			continue;
+
+		if (bits == 0xffff)
+		{
+			for (int j = 0; j < 16; j++)
+				dest[i + j] = clut[source[i + j]];
+			if (setpri)
+				detail::update_priority16(&pri[i], pand, por);
+		}
+		else
+		{
+			for (int j = i; bits != 0; bits >>= 1, j++)
+				if (bits & 1)
+					dest[j] = clut[source[j]];
+			if (setpri)
+				detail::update_priority16(&pri[i], sel, pand, por);
+		}
+	}
+	masked_rgb32_generic(&dest[i], &source[i], &maskptr[i], mask, value, count - i, pens, &pri[i], pcode);
+}
+
+inline void opaque_rgb32_alpha(u32 *dest, const u16 *source, int count, const rgb_t *pens, u8 *pri, u32 pcode, u8 alpha)
+{
+	const rgb_t *clut = &pens[pcode >> 16];
+	bool const setpri = (pcode & 0xffff) != 0xff00;
+	__m128i const slevel = _mm_set1_epi16(alpha);
+	__m128i const dlevel = _mm_set1_epi16(256 - alpha);
+	__m128i const pand = _mm_set1_epi8(char(pcode >> 8));
+	__m128i const por = _mm_set1_epi8(char(pcode));
+	int i = 0;
+	for ( ; i + 16 <= count; i += 16)
+	{
+		for (int j = i; j < i + 16; j += 4)
+		{
+			__m128i *const d = reinterpret_cast<__m128i *>(&dest[j]);
+			_mm_storeu_si128(d, detail::blend4(_mm_loadu_si128(d), detail::lookup4(clut, &source[j]), slevel, dlevel));
+		}
+		if (setpri)
+			detail::update_priority16(&pri[i], pand, por);
+	}
+	opaque_rgb32_alpha_generic(&dest[i], &source[i], count - i, pens, &pri[i], pcode, alpha);
+}
+
+inline void masked_rgb32_alpha(u32 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, const rgb_t *pens, u8 *pri, u32 pcode, u8 alpha)
+{
+	if (!detail::mask_can_match(mask, value))
+		return;
+
+	const rgb_t *clut = &pens[pcode >> 16];
+	bool const setpri = (pcode & 0xffff) != 0xff00;
+	__m128i const vmask = _mm_set1_epi8(char(mask));
+	__m128i const vvalue = _mm_set1_epi8(char(value));
+	__m128i const slevel = _mm_set1_epi16(alpha);
+	__m128i const dlevel = _mm_set1_epi16(256 - alpha);
+	__m128i const pand = _mm_set1_epi8(char(pcode >> 8));
+	__m128i const por = _mm_set1_epi8(char(pcode));
+	int i = 0;
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i const sel = detail::mask_match(&maskptr[i], vmask, vvalue);
+		if (_mm_movemask_epi8(sel) == 0)
+			continue;
+
+		// widen the byte selects to one per pixel, four pixels at a time
+		__m128i const sello = _mm_unpacklo_epi8(sel, sel);
+		__m128i const selhi = _mm_unpackhi_epi8(sel, sel);
+		__m128i const sel32[4] = {
+				_mm_unpacklo_epi16(sello, sello), _mm_unpackhi_epi16(sello, sello),
+				_mm_unpacklo_epi16(selhi, selhi), _mm_unpackhi_epi16(selhi, selhi) };
+		for (int k = 0; k < 4; k++)
+		{
+			if (_mm_movemask_epi8(sel32[k]) == 0)
+				continue;
+			int const j = i + k * 4;
+			__m128i *const d = reinterpret_cast<__m128i *>(&dest[j]);
+			__m128i const old = _mm_loadu_si128(d);
+			__m128i const blended = detail::blend4(old, detail::lookup4(clut, &source[j]), slevel, dlevel);
+			_mm_storeu_si128(d, detail::select(sel32[k], blended, old));
+		}
+		if (setpri)
+			detail::update_priority16(&pri[i], sel, pand, por);
+	}
+	masked_rgb32_alpha_generic(&dest[i], &source[i], &maskptr[i], mask, value, count - i, pens, &pri[i], pcode, alpha);
+}
+
+#else // MAME_TILESCAN_SSE2
+
+inline void opaque_null(int count, u8 *pri, u32 pcode) { opaque_null_generic(count, pri, pcode); }
+inline void masked_null(const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode) { masked_null_generic(maskptr, mask, value, count, pri, pcode); }
+inline void opaque_ind16(u16 *dest, const u16 *source, int count, u8 *pri, u32 pcode) { opaque_ind16_generic(dest, source, count, pri, pcode); }
+inline void masked_ind16(u16 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode) { masked_ind16_generic(dest, source, maskptr, mask, value, count, pri, pcode); }
+inline void opaque_rgb32(u32 *dest, const u16 *source, int count, const rgb_t *pens, u8 *pri, u32 pcode) { opaque_rgb32_generic(dest, source, count, pens, pri, pcode); }
+inline void masked_rgb32(u32 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, const rgb_t *pens, u8 *pri, u32 pcode) { masked_rgb32_generic(dest, source, maskptr, mask, value, count, pens, pri, pcode); }
+inline void opaque_rgb32_alpha(u32 *dest, const u16 *source, int count, const rgb_t *pens, u8 *pri, u32 pcode, u8 alpha) { opaque_rgb32_alpha_generic(dest, source, count, pens, pri, pcode, alpha); }
+inline void masked_rgb32_alpha(u32 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, const rgb_t *pens, u8 *pri, u32 pcode, u8 alpha) { masked_rgb32_alpha_generic(dest, source, maskptr, mask, value, count, pens, pri, pcode, alpha); }
+
+#endif // MAME_TILESCAN_SSE2
+
+} // namespace emu::tilescan
+
+#endif // MAME_EMU_VIDEO_TILESCAN_H
@@ -621,8 +621,9 @@ void lua_engine::initialize_render(sol::table &emu)
 			[] (palette_wrapper const &pal, uint32_t index) { return pal.palette().entry_contrast(index); });
 	palette_type.set_function(
 			"entry_adjusted_color",
-			[] (palette_wrapper const &pal, uint32_t index, std::optional<uint32_t> group)
+			[] (palette_wrapper &pal, uint32_t index, std::optional<uint32_t> group)
 			{
+				pal.palette().update();
 				if (group)
 				{
 					if ((pal.palette().num_colors() <= index) || (pal.palette().num_groups() <= *group))
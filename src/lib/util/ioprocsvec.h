@@ -12,6 +12,7 @@
 
 #include "ioprocs.h"
 
+#include <cassert>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
@@ -15,6 +15,11 @@
 #include <cmath>
 #include <cstdlib>
 
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_PALETTE_SSE2
+#include <emmintrin.h>
+#endif
+
 
 //**************************************************************************
 //  INLINE FUNCTIONS
@@ -168,6 +173,9 @@ palette_client::~palette_client()
 
 const uint32_t *palette_client::dirty_list(uint32_t &mindirty, uint32_t &maxdirty) noexcept
 {
+	// pending adjustments mark entries dirty, so apply them first
+	m_palette.update();
+
 	// if nothing to report, report nothing and don't swap
 	uint32_t const *const result = m_live->dirty_list(mindirty, maxdirty);
 	if (result)
@@ -214,6 +222,11 @@ palette_t::palette_t(uint32_t numcolors, uint32_t numgroups)
 		m_adjusted_rgb15(numcolors * numgroups + 2),
 		m_group_bright(numgroups),
 		m_group_contrast(numgroups),
+		m_pending(false),
+		m_pending_entries((numcolors + 31) / 32),
+		m_pending_start(numcolors),
+		m_pending_end(0),
+		m_pending_groups(numgroups),
 		m_client_list(nullptr)
 {
 	// initialize gamma map
@@ -285,9 +298,7 @@ void palette_t::set_brightness(float brightness)
 	m_brightness = brightness;
 
 	// update across all indices in all groups
-	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
-		for (int index = 0; index < m_numcolors; index++)
-			update_adjusted_color(groupnum, index);
+	mark_all_pending();
 }
 
 
@@ -304,9 +315,7 @@ void palette_t::set_contrast(float contrast)
 	m_contrast = contrast;
 
 	// update across all indices in all groups
-	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
-		for (int index = 0; index < m_numcolors; index++)
-			update_adjusted_color(groupnum, index);
+	mark_all_pending();
 }
 
 
@@ -332,9 +341,7 @@ void palette_t::set_gamma(float gamma)
 	}
 
 	// update across all indices in all groups
-	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
-		for (int index = 0; index < m_numcolors; index++)
-			update_adjusted_color(groupnum, index);
+	mark_all_pending();
 }
 
 
@@ -355,8 +362,7 @@ void palette_t::entry_set_color(uint32_t index, rgb_t rgb)
 	m_entry_color[index] = rgb;
 
 	// update across all groups
-	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
-		update_adjusted_color(groupnum, index);
+	mark_pending(index);
 }
 
 
@@ -377,8 +383,7 @@ void palette_t::entry_set_red_level(uint32_t index, uint8_t level)
 	m_entry_color[index].set_r(level);
 
 	// update across all groups
-	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
-		update_adjusted_color(groupnum, index);
+	mark_pending(index);
 }
 
 
@@ -399,8 +404,7 @@ void palette_t::entry_set_green_level(uint32_t index, uint8_t level)
 	m_entry_color[index].set_g(level);
 
 	// update across all groups
-	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
-		update_adjusted_color(groupnum, index);
+	mark_pending(index);
 }
 
 
@@ -421,8 +425,7 @@ void palette_t::entry_set_blue_level(uint32_t index, uint8_t level)
 	m_entry_color[index].set_b(level);
 
 	// update across all groups
-	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
-		update_adjusted_color(groupnum, index);
+	mark_pending(index);
 }
 
 
@@ -443,8 +446,7 @@ void palette_t::entry_set_contrast(uint32_t index, float contrast)
 	m_entry_contrast[index] = contrast;
 
 	// update across all groups
-	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
-		update_adjusted_color(groupnum, index);
+	mark_pending(index);
 }
 
 
@@ -468,8 +470,7 @@ void palette_t::group_set_brightness(uint32_t group, float brightness)
 	m_group_bright[group] = brightness;
 
 	// update across all colors
-	for (int index = 0; index < m_numcolors; index++)
-		update_adjusted_color(group, index);
+	mark_group_pending(group);
 }
 
 
@@ -490,8 +491,7 @@ void palette_t::group_set_contrast(uint32_t group, float contrast)
 	m_group_contrast[group] = contrast;
 
 	// update across all colors
-	for (int index = 0; index < m_numcolors; index++)
-		update_adjusted_color(group, index);
+	mark_group_pending(group);
 }
 
 
@@ -535,27 +535,165 @@ void palette_t::normalize_range(uint32_t start, uint32_t end, int lum_min, int l
 	}
 }
 
-/**
- * @fn  void palette_t::update_adjusted_color(uint32_t group, uint32_t index)
- *
- * @brief   -------------------------------------------------
- *            update_adjusted_color - update a color index by group and index pair
- *          -------------------------------------------------.
- *
- * @param   group   The group.
- * @param   index   Zero-based index of the.
- */
-
-void palette_t::update_adjusted_color(uint32_t group, uint32_t index)
+
+//-------------------------------------------------
+//  mark_pending - note that a raw entry changed,
+//  so its adjusted color in every group needs
+//  recomputing
+//-------------------------------------------------
+
+void palette_t::mark_pending(uint32_t index) noexcept
+{
+	m_pending.store(true, std::memory_order_relaxed);
+	m_pending_entries[index / 32] |= 1U << (index % 32);
+	m_pending_start = std::min(m_pending_start, index);
+	m_pending_end = std::max(m_pending_end, index + 1);
+}
+
+
+//-------------------------------------------------
+//  mark_group_pending - note that every adjusted
+//  color in a group needs recomputing
+//-------------------------------------------------
+
+void palette_t::mark_group_pending(uint32_t group) noexcept
+{
+	m_pending.store(true, std::memory_order_relaxed);
+	m_pending_groups[group] = true;
+}
+
+
+//-------------------------------------------------
+//  mark_all_pending - note that every adjusted
+//  color needs recomputing
+//-------------------------------------------------
+
+void palette_t::mark_all_pending() noexcept
+{
+	for (uint32_t group = 0; group < m_numgroups; group++)
+		mark_group_pending(group);
+}
+
+
+//-------------------------------------------------
+//  apply_pending - recompute each run of changed
+//  entries, and any groups changed as a whole
+//-------------------------------------------------
+
+void palette_t::apply_pending() noexcept
 {
-	// compute the adjusted value
-	rgb_t adjusted = adjust_palette_entry(m_entry_color[index],
-											m_group_bright[group] + m_brightness,
-											m_group_contrast[group] * m_entry_contrast[index] * m_contrast,
-											m_gamma_map);
+	m_pending.store(false, std::memory_order_relaxed);
 
+	// walk the runs of changed entries, skipping clean words
+	uint32_t index = m_pending_start;
+	while (index < m_pending_end)
+	{
+		uint32_t const bits = m_pending_entries[index / 32] >> (index % 32);
+		if (!bits)
+		{
+			index = (index | 31) + 1;
+			continue;
+		}
+		if (!(bits & 1))
+		{
+			index++;
+			continue;
+		}
+
+		uint32_t const start = index;
+		while ((index < m_pending_end) && ((m_pending_entries[index / 32] >> (index % 32)) & 1))
+			index++;
+		for (uint32_t group = 0; group < m_numgroups; group++)
+			if (!m_pending_groups[group])
+				update_adjusted_range(group, start, index - 1);
+	}
+
+	// groups changed as a whole cover any runs in them
+	for (uint32_t group = 0; group < m_numgroups; group++)
+	{
+		if (m_pending_groups[group] && m_numcolors)
+			update_adjusted_range(group, 0, m_numcolors - 1);
+		m_pending_groups[group] = false;
+	}
+
+	// clear the runs
+	if (m_pending_start < m_pending_end)
+		std::fill(&m_pending_entries[m_pending_start / 32], &m_pending_entries[(m_pending_end - 1) / 32] + 1, 0);
+	m_pending_start = m_numcolors;
+	m_pending_end = 0;
+}
+
+
+//-------------------------------------------------
+//  update_adjusted_range - recompute adjusted
+//  colors for a range of entries in one group
+//-------------------------------------------------
+
+void palette_t::update_adjusted_range(uint32_t group, uint32_t start, uint32_t end) noexcept
+{
+	float const brightness = m_group_bright[group] + m_brightness;
+	float const groupcontrast = m_group_contrast[group];
+	uint32_t const base = group * m_numcolors;
+	uint32_t index = start;
+
+#if defined(MAME_PALETTE_SSE2)
+	// four entries at a time: the gamma lookups are scalar, the scaling, clamping and packing are not
+	__m128 const bright = _mm_set1_ps(brightness);
+	__m128 const gcontrast = _mm_set1_ps(groupcontrast);
+	__m128 const contrast = _mm_set1_ps(m_contrast);
+	__m128i const alphamask = _mm_set1_epi32(0xff000000);
+	for ( ; (index + 3) <= end; index += 4)
+	{
+		rgb_t const *const raw = &m_entry_color[index];
+		__m128 const r = _mm_setr_ps(m_gamma_map[raw[0].r()], m_gamma_map[raw[1].r()], m_gamma_map[raw[2].r()], m_gamma_map[raw[3].r()]);
+		__m128 const g = _mm_setr_ps(m_gamma_map[raw[0].g()], m_gamma_map[raw[1].g()], m_gamma_map[raw[2].g()], m_gamma_map[raw[3].g()]);
+		__m128 const b = _mm_setr_ps(m_gamma_map[raw[0].b()], m_gamma_map[raw[1].b()], m_gamma_map[raw[2].b()], m_gamma_map[raw[3].b()]);
+
+		// same operation order as adjust_palette_entry so the results match exactly
+		__m128 const scale = _mm_mul_ps(_mm_mul_ps(gcontrast, _mm_loadu_ps(&m_entry_contrast[index])), contrast);
+		__m128i const ri = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(r, scale), bright));
+		__m128i const gi = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(g, scale), bright));
+		__m128i const bi = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(b, scale), bright));
+
+		// saturate to bytes (r0-r3 g0-g3 b0-b3) and interleave back into ARGB, keeping the raw alpha
+		__m128i const bytes = _mm_packus_epi16(_mm_packs_epi32(ri, gi), _mm_packs_epi32(bi, bi));
+		__m128i const bg = _mm_unpacklo_epi8(_mm_srli_si128(bytes, 8), _mm_srli_si128(bytes, 4));
+		__m128i const r0 = _mm_unpacklo_epi8(bytes, _mm_setzero_si128());
+		__m128i const adjusted = _mm_or_si128(_mm_unpacklo_epi16(bg, r0), _mm_and_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(raw)), alphamask));
+
+		// leave unchanged entries alone so clients aren't marked dirty
+		__m128i *const dest = reinterpret_cast<__m128i *>(&m_adjusted_color[base + index]);
+		int const same = _mm_movemask_epi8(_mm_cmpeq_epi32(adjusted, _mm_loadu_si128(dest)));
+		if (same == 0xffff)
+			continue;
+
+		__m128i const rgb15 = _mm_or_si128(
+				_mm_or_si128(_mm_and_si128(_mm_srli_epi32(adjusted, 9), _mm_set1_epi32(0x7c00)), _mm_and_si128(_mm_srli_epi32(adjusted, 6), _mm_set1_epi32(0x03e0))),
+				_mm_and_si128(_mm_srli_epi32(adjusted, 3), _mm_set1_epi32(0x001f)));
+		_mm_storeu_si128(dest, adjusted);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&m_adjusted_rgb15[base + index]), rgb15);
+
+		for (int lane = 0; lane < 4; lane++)
+			if (((same >> (lane * 4)) & 0xf) != 0xf)
+				for (palette_client *client = m_client_list; client != nullptr; client = client->next())
+					client->mark_dirty(base + index + lane);
+	}
+#endif
+
+	for ( ; index <= end; index++)
+		store_adjusted_color(base + index, adjust_palette_entry(m_entry_color[index], brightness, groupcontrast * m_entry_contrast[index] * m_contrast, m_gamma_map));
+}
+
+
+//-------------------------------------------------
+//  store_adjusted_color - update one adjusted
+//  color, marking it dirty in all clients if it
+//  changed
+//-------------------------------------------------
+
+void palette_t::store_adjusted_color(uint32_t finalindex, rgb_t adjusted) noexcept
+{
 	// if not different, ignore
-	uint32_t finalindex = group * m_numcolors + index;
 	if (m_adjusted_color[finalindex] == adjusted)
 		return;
 
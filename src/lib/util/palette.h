@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 
@@ -164,6 +165,12 @@ public:
 	void set_contrast(float contrast);
 	void set_gamma(float gamma);
 
+	// adjusted colors are recomputed in batches; the getters below don't do it, so call
+	// this before reading them, and not while another thread might be reading them;
+	// pending() may be checked from any thread
+	void update() noexcept { if (pending()) apply_pending(); }
+	bool pending() const noexcept { return m_pending.load(std::memory_order_relaxed); }
+
 	// entry getters
 	rgb_t entry_color(uint32_t index) const noexcept { return (index < m_numcolors) ? m_entry_color[index] : rgb_t::black(); }
 	rgb_t entry_adjusted_color(uint32_t index) const noexcept { return (index < m_numcolors * m_numgroups) ? m_adjusted_color[index] : rgb_t::black(); }
@@ -195,7 +202,12 @@ private:
 
 	// internal helpers
 	rgb_t adjust_palette_entry(rgb_t entry, float brightness, float contrast, const uint8_t *gamma_map);
-	void update_adjusted_color(uint32_t group, uint32_t index);
+	void mark_pending(uint32_t index) noexcept;
+	void mark_group_pending(uint32_t group) noexcept;
+	void mark_all_pending() noexcept;
+	void apply_pending() noexcept;
+	void update_adjusted_range(uint32_t group, uint32_t start, uint32_t end) noexcept;
+	void store_adjusted_color(uint32_t finalindex, rgb_t adjusted) noexcept;
 
 	// internal state
 	uint32_t           m_refcount;              // reference count on the palette
@@ -215,6 +227,12 @@ private:
 	std::vector<float> m_group_bright;          // brightness value for each group
 	std::vector<float> m_group_contrast;        // contrast value for each group
 
+	std::atomic<bool>  m_pending;               // are any adjusted colors out of date?
+	std::vector<uint32_t> m_pending_entries;    // bitmap of raw entries changed, in every group
+	uint32_t           m_pending_start;         // first changed raw entry
+	uint32_t           m_pending_end;           // one past the last changed raw entry
+	std::vector<bool>  m_pending_groups;        // groups to recompute in full
+
 	palette_client *m_client_list;                // list of clients for this palette
 };
 
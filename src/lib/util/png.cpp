@@ -14,6 +14,7 @@
 #include "unicode.h"
 
 #include "osdcomm.h"
+#include "osdcore.h"
 
 #include <zlib.h>
 
@@ -985,7 +986,7 @@ static std::error_condition write_chunk(write_stream &fp, const uint8_t *data, u
     chunk to the given file by deflating it
 -------------------------------------------------*/
 
-static std::error_condition write_deflated_chunk(random_write &fp, uint8_t *data, uint32_t type, uint32_t length) noexcept
+static std::error_condition write_deflated_chunk(random_write &fp, uint8_t *data, uint32_t type, uint32_t length, int level) noexcept
 {
 	std::error_condition err;
 	std::uint64_t lengthpos;
@@ -1016,7 +1017,7 @@ static std::error_condition write_deflated_chunk(random_write &fp, uint8_t *data
 	memset(&stream, 0, sizeof(stream));
 	stream.next_in = data;
 	stream.avail_in = length;
-	zerr = deflateInit(&stream, Z_DEFAULT_COMPRESSION);
+	zerr = deflateInit(&stream, level);
 	if (Z_ERRNO == zerr)
 		return std::error_condition(errno, std::generic_category());
 	else if (Z_MEM_ERROR == zerr)
@@ -1101,6 +1102,217 @@ static std::error_condition write_deflated_chunk(random_write &fp, uint8_t *data
 }
 
 
+/*-------------------------------------------------
+    deflate_segment - one independently deflated
+    piece of a parallel IDAT
+-------------------------------------------------*/
+
+namespace {
+
+// segments are deflated separately, each primed with the 32K window before it
+constexpr std::uint32_t DEFLATE_SEGMENT_BYTES = 128 * 1024;
+constexpr std::uint32_t DEFLATE_WINDOW_BYTES = 32 * 1024;
+
+struct deflate_segment
+{
+	std::uint8_t const *                data;
+	std::uint32_t                       length;
+	std::uint32_t                       dictlength;
+	int                                 level;
+	bool                                last;
+	std::unique_ptr<std::uint8_t []>    output;
+	std::uint32_t                       outlength;
+	std::uint32_t                       adler;
+	int                                 zerr;
+	osd_work_item *                     item;
+};
+
+} // anonymous namespace
+
+
+/*-------------------------------------------------
+    deflate_segment_callback - deflate a segment
+    as a raw stream ending on a byte boundary
+-------------------------------------------------*/
+
+static void *deflate_segment_callback(void *param, int threadid)
+{
+	deflate_segment &seg = *reinterpret_cast<deflate_segment *>(param);
+	seg.adler = adler32(1, seg.data, seg.length);
+
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+	seg.zerr = deflateInit2(&stream, seg.level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+	if (Z_OK != seg.zerr)
+		return nullptr;
+
+	// prime the window so matches can reach back into the previous segment
+	if (seg.dictlength)
+		seg.zerr = deflateSetDictionary(&stream, seg.data - seg.dictlength, seg.dictlength);
+
+	// all but the last segment end with a sync flush so they can be concatenated
+	uLong const bound = deflateBound(&stream, seg.length) + 64;
+	seg.output.reset(new (std::nothrow) std::uint8_t [bound]);
+	if (!seg.output)
+		seg.zerr = Z_MEM_ERROR;
+	if (Z_OK == seg.zerr)
+	{
+		stream.next_in = const_cast<Bytef *>(seg.data);
+		stream.avail_in = seg.length;
+		stream.next_out = seg.output.get();
+		stream.avail_out = bound;
+		seg.zerr = deflate(&stream, seg.last ? Z_FINISH : Z_SYNC_FLUSH);
+		if (seg.last ? (Z_STREAM_END == seg.zerr) : ((Z_OK == seg.zerr) && !stream.avail_in && stream.avail_out))
+			seg.zerr = Z_OK;
+		else if ((Z_OK == seg.zerr) || (Z_STREAM_END == seg.zerr))
+			seg.zerr = Z_BUF_ERROR;
+		seg.outlength = bound - stream.avail_out;
+	}
+	deflateEnd(&stream);
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    write_parallel_deflated_chunk - write a chunk
+    as a single zlib stream, deflating segments
+    of it on a work queue
+-------------------------------------------------*/
+
+static std::error_condition write_parallel_deflated_chunk(random_write &fp, uint8_t *data, uint32_t type, uint32_t length, int level, osd_work_queue *queue) noexcept
+{
+	std::uint32_t const count = (length + DEFLATE_SEGMENT_BYTES - 1) / DEFLATE_SEGMENT_BYTES;
+	std::unique_ptr<deflate_segment []> segments(new (std::nothrow) deflate_segment [count]);
+	if (!segments)
+		return std::errc::not_enough_memory;
+
+	// queue every segment, running it here if the queue won't take it
+	for (std::uint32_t index = 0; index < count; index++)
+	{
+		deflate_segment &seg = segments[index];
+		std::uint32_t const offset = index * DEFLATE_SEGMENT_BYTES;
+		seg.data = data + offset;
+		seg.length = std::min(DEFLATE_SEGMENT_BYTES, length - offset);
+		seg.dictlength = std::min(DEFLATE_WINDOW_BYTES, offset);
+		seg.level = level;
+		seg.last = (count - 1) == index;
+		seg.outlength = 0;
+		seg.zerr = Z_OK;
+		seg.item = osd_work_item_queue(queue, deflate_segment_callback, &seg, 0);
+		if (!seg.item)
+			deflate_segment_callback(&seg, 0);
+	}
+
+	// wait for them all, checksumming the whole chunk as we go
+	std::uint32_t zlength = 2 + 4;
+	std::uint32_t adler = 1;
+	int zerr = Z_OK;
+	for (std::uint32_t index = 0; index < count; index++)
+	{
+		deflate_segment &seg = segments[index];
+		if (seg.item)
+		{
+			osd_work_item_wait(seg.item, osd_ticks_per_second() * 100);
+			osd_work_item_release(seg.item);
+		}
+		if (Z_OK == zerr)
+			zerr = seg.zerr;
+		adler = index ? adler32_combine(adler, seg.adler, seg.length) : seg.adler;
+		zlength += seg.outlength;
+	}
+	if (Z_MEM_ERROR == zerr)
+		return std::errc::not_enough_memory;
+	else if (Z_OK != zerr)
+		return png_error::COMPRESS_ERROR;
+
+	// assemble the zlib header, the raw segments and the checksum
+	std::unique_ptr<std::uint8_t []> zdata(new (std::nothrow) std::uint8_t [zlength]);
+	if (!zdata)
+		return std::errc::not_enough_memory;
+	unsigned const flevel = (level < 0) ? 2 : (level < 2) ? 0 : (level < 6) ? 1 : (level == 6) ? 2 : 3;
+	unsigned header = (0x78 << 8) | (flevel << 6);
+	header += 31 - (header % 31);
+	zdata[0] = std::uint8_t(header >> 8);
+	zdata[1] = std::uint8_t(header);
+	std::uint8_t *dst = &zdata[2];
+	for (std::uint32_t index = 0; index < count; index++)
+		dst = std::copy_n(segments[index].output.get(), segments[index].outlength, dst);
+	put_32bit(dst, adler);
+
+	return write_chunk(fp, zdata.get(), type, zlength);
+}
+
+
+/*-------------------------------------------------
+    filter_image_rows - replace the unfiltered
+    rows of an RGB image with whichever prediction
+    filter gives the smallest residuals
+-------------------------------------------------*/
+
+static std::error_condition filter_image_rows(png_info &pnginfo) noexcept
+{
+	// palette indices don't predict well, so those stay unfiltered as the PNG spec suggests
+	if ((3 == pnginfo.color_type) || (8 != pnginfo.bit_depth))
+		return std::error_condition();
+
+	std::uint32_t const bpp = samples[pnginfo.color_type];
+	std::uint32_t const rowbytes = compute_rowbytes(pnginfo);
+	std::uint32_t const stride = rowbytes + 1;
+
+	// the first row predicts from an all-zero row above it
+	std::unique_ptr<std::uint8_t []> filtered(new (std::nothrow) std::uint8_t [pnginfo.height * stride]);
+	std::unique_ptr<std::uint8_t []> scratch(new (std::nothrow) std::uint8_t [5 * rowbytes]);
+	if (!filtered || !scratch)
+		return std::errc::not_enough_memory;
+	std::uint8_t *const zero = &scratch[4 * rowbytes];
+	std::fill_n(zero, rowbytes, 0);
+
+	for (std::uint32_t y = 0; y < pnginfo.height; y++)
+	{
+		std::uint8_t const *const cur = &pnginfo.image[y * stride + 1];
+		std::uint8_t const *const prev = y ? (cur - stride) : zero;
+		std::uint8_t *const candidate[5] = { nullptr, &scratch[0], &scratch[rowbytes], &scratch[2 * rowbytes], &scratch[3 * rowbytes] };
+
+		// score each filter by the sum of its residuals taken as signed bytes
+		std::uint32_t score[5] = { 0, 0, 0, 0, 0 };
+		for (std::uint32_t x = 0; x < rowbytes; x++)
+		{
+			int32_t const pa((x < bpp) ? 0 : cur[x - bpp]);
+			int32_t const pb(prev[x]);
+			int32_t const pc((x < bpp) ? 0 : prev[x - bpp]);
+			int32_t const prediction(pa + pb - pc);
+			int32_t const da(std::abs(prediction - pa));
+			int32_t const db(std::abs(prediction - pb));
+			int32_t const dc(std::abs(prediction - pc));
+			int32_t const paeth(((da <= db) && (da <= dc)) ? pa : (db <= dc) ? pb : pc);
+
+			std::uint8_t const value(cur[x]);
+			candidate[PNG_PF_Sub][x] = value - pa;
+			candidate[PNG_PF_Up][x] = value - pb;
+			candidate[PNG_PF_Average][x] = value - ((pa + pb) >> 1);
+			candidate[PNG_PF_Paeth][x] = value - paeth;
+			score[PNG_PF_None] += std::abs(std::int8_t(value));
+			score[PNG_PF_Sub] += std::abs(std::int8_t(candidate[PNG_PF_Sub][x]));
+			score[PNG_PF_Up] += std::abs(std::int8_t(candidate[PNG_PF_Up][x]));
+			score[PNG_PF_Average] += std::abs(std::int8_t(candidate[PNG_PF_Average][x]));
+			score[PNG_PF_Paeth] += std::abs(std::int8_t(candidate[PNG_PF_Paeth][x]));
+		}
+
+		std::uint8_t best = PNG_PF_None;
+		for (std::uint8_t type = PNG_PF_Sub; type <= PNG_PF_Paeth; type++)
+			if (score[type] < score[best])
+				best = type;
+
+		std::uint8_t *const dst = &filtered[y * stride];
+		dst[0] = best;
+		std::copy_n((PNG_PF_None == best) ? cur : candidate[best], rowbytes, dst + 1);
+	}
+
+	pnginfo.image = std::move(filtered);
+	return std::error_condition();
+}
+
+
 /*-------------------------------------------------
     convert_bitmap_to_image_palette - convert a
     bitmap to a palettized image
@@ -1237,7 +1449,7 @@ static std::error_condition convert_bitmap_to_image_rgb(png_info &pnginfo, bitma
     chunks to the given file
 -------------------------------------------------*/
 
-static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette) noexcept
+static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette, png_write_options const &options) noexcept
 {
 	uint8_t tempbuff[16];
 	std::error_condition error;
@@ -1250,7 +1462,13 @@ static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo
 	if (error)
 		return error;
 
-	// if we wanted to get clever and do filtering, we would do it here
+	// pick a prediction filter for each row
+	if (options.adaptive_filter)
+	{
+		error = filter_image_rows(pnginfo);
+		if (error)
+			return error;
+	}
 
 	// write the IHDR chunk
 	put_32bit(tempbuff + 0, pnginfo.width);
@@ -1270,8 +1488,12 @@ static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo
 	if (error)
 		return error;
 
-	// write a single IDAT chunk
-	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1));
+	// write a single IDAT chunk, deflating big images in parallel if we have a queue
+	std::uint32_t const imagebytes = pnginfo.height * (compute_rowbytes(pnginfo) + 1);
+	if (options.queue && (imagebytes >= 2 * DEFLATE_SEGMENT_BYTES))
+		error = write_parallel_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, imagebytes, options.level, options.queue);
+	else
+		error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, imagebytes, options.level);
 	if (error)
 		return error;
 
@@ -1319,6 +1541,12 @@ static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo
 
 
 std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette) noexcept
+{
+	return png_write_bitmap(fp, info, bitmap, palette_length, palette, png_write_options());
+}
+
+
+std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, png_write_options const &options) noexcept
 {
 	// use a dummy pnginfo if none passed to us
 	png_info pnginfo;
@@ -1334,7 +1562,7 @@ std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t
 		return std::errc::io_error;
 
 	// write the rest of the PNG data
-	return write_png_stream(fp, *info, bitmap, palette_length, palette);
+	return write_png_stream(fp, *info, bitmap, palette_length, palette, options);
 }
 
 
@@ -1366,7 +1594,13 @@ std::error_condition mng_capture_start(random_write &fp, bitmap_t const &bitmap,
 
 std::error_condition mng_capture_frame(random_write &fp, png_info &info, bitmap_t const &bitmap, int palette_length, rgb_t const *palette) noexcept
 {
-	return write_png_stream(fp, info, bitmap, palette_length, palette);
+	return write_png_stream(fp, info, bitmap, palette_length, palette, png_write_options());
+}
+
+
+std::error_condition mng_capture_frame(random_write &fp, png_info &info, bitmap_t const &bitmap, int palette_length, rgb_t const *palette, png_write_options const &options) noexcept
+{
+	return write_png_stream(fp, info, bitmap, palette_length, palette, options);
 }
 
 
@@ -25,6 +25,9 @@
 #include <utility>
 
 
+struct osd_work_queue;
+
+
 namespace util {
 
 /***************************************************************************
@@ -98,6 +101,20 @@ private:
 
 
 
+struct png_write_options
+{
+	// zlib compression level; -1 uses zlib's default, 1 is fastest
+	int                 level = -1;
+
+	// choose a prediction filter for each row instead of writing them unfiltered
+	bool                adaptive_filter = true;
+
+	// if set, large images are deflated as independent segments on this queue
+	osd_work_queue *    queue = nullptr;
+};
+
+
+
 /***************************************************************************
     FUNCTION PROTOTYPES
 ***************************************************************************/
@@ -105,9 +122,11 @@ private:
 std::error_condition png_read_bitmap(read_stream &fp, bitmap_argb32 &bitmap) noexcept;
 
 std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette) noexcept;
+std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, png_write_options const &options) noexcept;
 
 std::error_condition mng_capture_start(random_write &fp, bitmap_t const &bitmap, unsigned rate) noexcept;
 std::error_condition mng_capture_frame(random_write &fp, png_info &info, bitmap_t const &bitmap, int palette_length, rgb_t const *palette) noexcept;
+std::error_condition mng_capture_frame(random_write &fp, png_info &info, bitmap_t const &bitmap, int palette_length, rgb_t const *palette, png_write_options const &options) noexcept;
 std::error_condition mng_capture_stop(random_write &fp) noexcept;
 
 } // namespace util
@@ -35,7 +35,7 @@ struct midvunit_object_data
 
 class midvunit_state;
 
-class midvunit_renderer : public poly_manager<float, midvunit_object_data, 2>
+class midvunit_renderer : public poly_manager<float, midvunit_object_data, 2, POLY_FLAG_NO_TILING>
 {
 public:
 	midvunit_renderer(midvunit_state &state);
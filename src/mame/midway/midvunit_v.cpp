@@ -28,7 +28,7 @@
 
 
 midvunit_renderer::midvunit_renderer(midvunit_state &state)
-	: poly_manager<float, midvunit_object_data, 2>(state.machine())
+	: poly_manager<float, midvunit_object_data, 2, POLY_FLAG_NO_TILING>(state.machine())
 	, m_state(state)
 {
 }
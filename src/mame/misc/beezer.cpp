@@ -494,6 +494,7 @@ void beezer_state::beezer(machine_config &config)
 	SCREEN(config, m_screen, SCREEN_TYPE_RASTER);
 	m_screen->set_raw(12_MHz_XTAL / 2, 384, 16, 304, 260, 0, 240); // 288 x 240, correct?
 	m_screen->set_screen_update(FUNC(beezer_state::screen_update));
+	m_screen->set_video_attributes(VIDEO_UPDATE_THREADSAFE);
 	m_screen->set_palette(m_palette);
 
 	PALETTE(config, m_palette, FUNC(beezer_state::palette_init), 16);
@@ -2144,22 +2144,24 @@ void namcos22_state::namcos22_mix_text_layer(screen_device &screen, bitmap_rgb32
 					pixel = pens[src[x]];
 			}
 
-			// apply global fade
-			if (fade_enabled)
+			if (fade_white)
 			{
-				if (fade_white)
-				{
-					// need to make sure that blacks can scale up
-					if (!(pixel & 0xff0000)) pixel += fade_r_add;
-					if (!(pixel & 0x00ff00)) pixel += fade_g_add;
-					if (!(pixel & 0x0000ff)) pixel += fade_b_add;
-				}
-				rgbaint_t rgb(pixel);
-				rgb.scale_and_clamp(fade_color);
-				pixel = rgb.to_rgba();
+				// need to make sure that blacks can scale up
+				if (!(pixel & 0xff0000)) pixel += fade_r_add;
+				if (!(pixel & 0x00ff00)) pixel += fade_g_add;
+				if (!(pixel & 0x0000ff)) pixel += fade_b_add;
 			}
+			dest[x] = pixel;
+		}
 
-			// apply gamma
+		// apply global fade to the whole row at once
+		if (fade_enabled)
+			rgb_scale_span(&dest[cliprect.left()], &dest[cliprect.left()], cliprect.width(), fade_color);
+
+		// apply gamma
+		for (int x = cliprect.left(); x <= cliprect.right(); x++)
+		{
+			u32 const pixel = dest[x];
 			dest[x] = (rlut[(pixel >> 16) & 0xff] << 16) | (glut[(pixel >> 8) & 0xff] << 8) | blut[pixel & 0xff];
 		}
 	}
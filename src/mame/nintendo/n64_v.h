@@ -129,7 +129,7 @@ class n64_rdp;
 
 class n64_state;
 
-class n64_rdp : public poly_manager<uint32_t, rdp_poly_state, 8>
+class n64_rdp : public poly_manager<uint32_t, rdp_poly_state, 8, POLY_FLAG_NO_TILING>
 {
 public:
 	n64_rdp(n64_state &state, uint32_t* rdram, uint32_t* dmem);
@@ -2384,7 +2384,7 @@ inline uint32_t powervr2_device::sample_textured(texinfo *ti, float u, float v,
 }
 
 template <powervr2_device::pix_sample_fn sample_fn, int group_no>
-inline void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, float xl, float xr, float ul, float ur, float vl, float vr, float wl, float wr, float const bl_in[4], float const br_in[4], float const offl_in[4], float const offr_in[4])
+inline void powervr2_device::render_hline(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, int y, float xl, float xr, float ul, float ur, float vl, float vr, float wl, float wr, float const bl_in[4], float const br_in[4], float const offl_in[4], float const offr_in[4])
 {
 	int idx;
 	int xxl, xxr;
@@ -2394,7 +2394,7 @@ inline void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int
 
 	float bl[4], offl[4];
 
-	if(xr < 0 || xl >= 640)
+	if(xr < clip.min_x || xl >= clip.max_x + 1)
 		return;
 
 	xxl = round(xl);
@@ -2427,10 +2427,10 @@ inline void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int
 		(offr_in[3] - offl[3]) * dx_recip
 	};
 
-	if(xxl < 0)
-		xxl = 0;
-	if(xxr > 640)
-		xxr = 640;
+	if(xxl < clip.min_x)
+		xxl = clip.min_x;
+	if(xxr > clip.max_x + 1)
+		xxr = clip.max_x + 1;
 
 	// Target the pixel center
 	ddx = xxl + 0.5f - xl;
@@ -2478,7 +2478,7 @@ inline void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int
 }
 
 template <powervr2_device::pix_sample_fn sample_fn, int group_no>
-inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti,
 									float y0, float y1,
 									float xl, float xr,
 									float ul, float ur,
@@ -2497,10 +2497,10 @@ inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
 	float dy;
 	int yy0, yy1;
 
-	if(y1 <= 0)
+	if(y1 <= clip.min_y)
 		return;
-	if(y1 > 480)
-		y1 = 480;
+	if(y1 > clip.max_y + 1)
+		y1 = clip.max_y + 1;
 
 	float bl[4], br[4], offl[4], offr[4];
 	memcpy(bl, bl_in, sizeof(bl));
@@ -2508,23 +2508,24 @@ inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
 	memcpy(offl, offl_in, sizeof(offl));
 	memcpy(offr, offr_in, sizeof(offr));
 
-	if(y0 < 0) {
-		xl += -dxldy*y0;
-		xr += -dxrdy*y0;
-		ul += -duldy*y0;
-		ur += -durdy*y0;
-		vl += -dvldy*y0;
-		vr += -dvrdy*y0;
-		wl += -dwldy*y0;
-		wr += -dwrdy*y0;
+	if(y0 < clip.min_y) {
+		float const skip = clip.min_y - y0;
+		xl += dxldy*skip;
+		xr += dxrdy*skip;
+		ul += duldy*skip;
+		ur += durdy*skip;
+		vl += dvldy*skip;
+		vr += dvrdy*skip;
+		wl += dwldy*skip;
+		wr += dwrdy*skip;
 
 		for (idx = 0; idx < 4; idx++) {
-			bl[idx] += -dbldy[idx] * y0;
-			br[idx] += -dbrdy[idx] * y0;
-			offl[idx] += -doldy[idx] * y0;
-			offr[idx] += -dordy[idx] * y0;
+			bl[idx] += dbldy[idx] * skip;
+			br[idx] += dbrdy[idx] * skip;
+			offl[idx] += doldy[idx] * skip;
+			offr[idx] += dordy[idx] * skip;
 		}
-		y0 = 0;
+		y0 = clip.min_y;
 	}
 
 	yy0 = round(y0);
@@ -2556,7 +2557,7 @@ inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
 	}
 
 	while(yy0 < yy1) {
-		render_hline<sample_fn, group_no>(bitmap, ti, yy0, xl, xr, ul, ur, vl, vr, wl, wr, bl, br, offl, offr);
+		render_hline<sample_fn, group_no>(bitmap, clip, ti, yy0, xl, xr, ul, ur, vl, vr, wl, wr, bl, br, offl, offr);
 
 		xl += dxldy;
 		xr += dxrdy;
@@ -2609,13 +2610,13 @@ void powervr2_device::sort_vertices(const vert *v, int *i0, int *i1, int *i2)
 
 
 template <powervr2_device::pix_sample_fn sample_fn, int group_no>
-inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v0, const vert *v1, const vert *v2)
+inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, const vert *v0, const vert *v1, const vert *v2)
 {
 	float dy01, dy02, dy12;
 
 	float dx01dy, dx02dy, dx12dy, du01dy, du02dy, du12dy, dv01dy, dv02dy, dv12dy, dw01dy, dw02dy, dw12dy;
 
-	if(v0->y >= 480 || v2->y < 0)
+	if(v0->y >= clip.max_y + 1 || v2->y < clip.min_y)
 		return;
 
 	float db01[4] = {
@@ -2727,15 +2728,15 @@ inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti
 			return;
 
 		if(v1->x > v0->x)
-			render_span<sample_fn, group_no>(bitmap, ti, v1->y, v2->y, v0->x, v1->x, v0->u, v1->u, v0->v, v1->v, v0->w, v1->w, v0->b, v1->b, v0->o, v1->o, dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy, db02dy, db12dy, do02dy, do12dy);
+			render_span<sample_fn, group_no>(bitmap, clip, ti, v1->y, v2->y, v0->x, v1->x, v0->u, v1->u, v0->v, v1->v, v0->w, v1->w, v0->b, v1->b, v0->o, v1->o, dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy, db02dy, db12dy, do02dy, do12dy);
 		else
-			render_span<sample_fn, group_no>(bitmap, ti, v1->y, v2->y, v1->x, v0->x, v1->u, v0->u, v1->v, v0->v, v1->w, v0->w, v1->b, v0->b, v1->o, v0->o, dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy, db12dy, db02dy, do12dy, do02dy);
+			render_span<sample_fn, group_no>(bitmap, clip, ti, v1->y, v2->y, v1->x, v0->x, v1->u, v0->u, v1->v, v0->v, v1->w, v0->w, v1->b, v0->b, v1->o, v0->o, dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy, db12dy, db02dy, do12dy, do02dy);
 
 	} else if(!dy12) {
 		if(v2->x > v1->x)
-			render_span<sample_fn, group_no>(bitmap, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o, dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy, db01dy, db02dy, do01dy, do02dy);
+			render_span<sample_fn, group_no>(bitmap, clip, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o, dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy, db01dy, db02dy, do01dy, do02dy);
 		else
-			render_span<sample_fn, group_no>(bitmap, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o, dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy, db02dy, db01dy, do02dy, do01dy);
+			render_span<sample_fn, group_no>(bitmap, clip, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o, dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy, db02dy, db01dy, do02dy, do01dy);
 
 	} else {
 			float idk_b[4] = {
@@ -2751,17 +2752,17 @@ inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti
 				v0->o[3] + do02dy[3] * dy01
 			};
 		if(dx01dy < dx02dy) {
-			render_span<sample_fn, group_no>(bitmap, ti, v0->y, v1->y,
+			render_span<sample_fn, group_no>(bitmap, clip, ti, v0->y, v1->y,
 						v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o,
 						dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy, db01dy, db02dy, do01dy, do02dy);
-			render_span<sample_fn, group_no>(bitmap, ti, v1->y, v2->y,
+			render_span<sample_fn, group_no>(bitmap, clip, ti, v1->y, v2->y,
 						v1->x, v0->x + dx02dy*dy01, v1->u, v0->u + du02dy*dy01, v1->v, v0->v + dv02dy*dy01, v1->w, v0->w + dw02dy*dy01, v1->b, idk_b, v1->o, idk_o,
 						dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy, db12dy, db02dy, do12dy, do02dy);
 		} else {
-			render_span<sample_fn, group_no>(bitmap, ti, v0->y, v1->y,
+			render_span<sample_fn, group_no>(bitmap, clip, ti, v0->y, v1->y,
 						v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o,
 						dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy, db02dy, db01dy, do02dy, do01dy);
-			render_span<sample_fn, group_no>(bitmap, ti, v1->y, v2->y,
+			render_span<sample_fn, group_no>(bitmap, clip, ti, v1->y, v2->y,
 						v0->x + dx02dy*dy01, v1->x, v0->u + du02dy*dy01, v1->u, v0->v + dv02dy*dy01, v1->v, v0->w + dw02dy*dy01, v1->w, idk_b, v1->b, idk_o, v1->o,
 						dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy, db02dy, db12dy, do02dy, do12dy);
 		}
@@ -2769,7 +2770,7 @@ inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti
 }
 
 template <int group_no>
-void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v)
+void powervr2_device::render_tri(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, const vert *v)
 {
 	int i0, i1, i2;
 
@@ -2782,16 +2783,16 @@ void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *
 		if (bilinear) {
 			switch (ti->tsinstruction) {
 			case 0:
-				render_tri_sorted<&powervr2_device::sample_textured<0,true>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<0,true>, group_no>(bitmap, clip, ti, v+i0, v+i1, v+i2);
 				break;
 			case 1:
-				render_tri_sorted<&powervr2_device::sample_textured<1,true>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<1,true>, group_no>(bitmap, clip, ti, v+i0, v+i1, v+i2);
 				break;
 			case 2:
-				render_tri_sorted<&powervr2_device::sample_textured<2,true>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<2,true>, group_no>(bitmap, clip, ti, v+i0, v+i1, v+i2);
 				break;
 			case 3:
-				render_tri_sorted<&powervr2_device::sample_textured<3,true>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<3,true>, group_no>(bitmap, clip, ti, v+i0, v+i1, v+i2);
 				break;
 			default:
 				/*
@@ -2799,21 +2800,21 @@ void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *
 				 * AND'd with 3
 				 */
 				logerror("%s - tsinstruction is 0x%08x\n", (unsigned)ti->tsinstruction);
-				render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, clip, ti, v+i0, v+i1, v+i2);
 			}
 		} else {
 			switch (ti->tsinstruction) {
 			case 0:
-				render_tri_sorted<&powervr2_device::sample_textured<0,false>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<0,false>, group_no>(bitmap, clip, ti, v+i0, v+i1, v+i2);
 				break;
 			case 1:
-				render_tri_sorted<&powervr2_device::sample_textured<1,false>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<1,false>, group_no>(bitmap, clip, ti, v+i0, v+i1, v+i2);
 				break;
 			case 2:
-				render_tri_sorted<&powervr2_device::sample_textured<2,false>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<2,false>, group_no>(bitmap, clip, ti, v+i0, v+i1, v+i2);
 				break;
 			case 3:
-				render_tri_sorted<&powervr2_device::sample_textured<3,false>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<3,false>, group_no>(bitmap, clip, ti, v+i0, v+i1, v+i2);
 				break;
 			default:
 				/*
@@ -2821,29 +2822,26 @@ void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *
 				 * AND'd with 3
 				 */
 				logerror("%s - tsinstruction is 0x%08x\n", (unsigned)ti->tsinstruction);
-				render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, clip, ti, v+i0, v+i1, v+i2);
 			}
 		}
 	} else {
-			render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+			render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, clip, ti, v+i0, v+i1, v+i2);
 	}
 }
 
-template <int group_no>
-void powervr2_device::render_group_to_accumulation_buffer(bitmap_rgb32 &bitmap,const rectangle &cliprect)
+int powervr2_device::tile_for(float coord, int tiles)
 {
-#if 0
-	int stride;
-	uint16_t *bmpaddr16;
-	uint32_t k;
-#endif
-
-
-	if (renderselect < 0)
-		return;
-
-	//printf("drawtest!\n");
+	if(!(coord >= 0))
+		return 0;
+	if(coord >= tiles * TILE_SIZE)
+		return tiles - 1;
+	return int(coord) / TILE_SIZE;
+}
 
+template <int group_no>
+void powervr2_device::bin_group_to_tiles()
+{
 	int rs=renderselect;
 
 	struct poly_group *grp = grab[rs].groups + group_no;
@@ -2866,13 +2864,50 @@ void powervr2_device::render_group_to_accumulation_buffer(bitmap_rgb32 &bitmap,c
 			tv->v = tv->v * ts->ti.sizey * tv->w;
 		}
 
+		if (debug_dip_status&0x2)
+			continue;
+
 		for(i=sv; i <= ev-2; i++)
 		{
-			if (!(debug_dip_status&0x2))
-				render_tri<group_no>(bitmap, &ts->ti, grab[rs].verts + i);
+			const vert *tv = grab[rs].verts + i;
+			float const minx = std::min({ tv[0].x, tv[1].x, tv[2].x });
+			float const maxx = std::max({ tv[0].x, tv[1].x, tv[2].x });
+			float const miny = std::min({ tv[0].y, tv[1].y, tv[2].y });
+			float const maxy = std::max({ tv[0].y, tv[1].y, tv[2].y });
+			if(maxx < 0 || minx >= 640 || maxy < 0 || miny >= 480)
+				continue;
+
+			// a pixel of slack either way covers the rounding in render_span/render_hline
+			int const tx0 = tile_for(minx - 1, TILES_X);
+			int const tx1 = tile_for(maxx + 1, TILES_X);
+			int const ty0 = tile_for(miny - 1, TILES_Y);
+			int const ty1 = tile_for(maxy + 1, TILES_Y);
+			for(int ty = ty0; ty <= ty1; ty++)
+				for(int tx = tx0; tx <= tx1; tx++)
+					m_render_tiles[ty * TILES_X + tx].tris.push_back(binned_tri{ &ts->ti, tv, group_no });
+		}
+	}
+}
 
+void *powervr2_device::render_tile_callback(void *param, int threadid)
+{
+	render_tile &tile = *reinterpret_cast<render_tile *>(param);
+	powervr2_device &pvr = *tile.pvr;
+
+	for(binned_tri const &tri : tile.tris) {
+		switch(tri.group_no) {
+		case DISPLAY_LIST_OPAQUE:
+			pvr.render_tri<DISPLAY_LIST_OPAQUE>(*tile.bitmap, tile.clip, tri.ti, tri.v);
+			break;
+		case DISPLAY_LIST_TRANS:
+			pvr.render_tri<DISPLAY_LIST_TRANS>(*tile.bitmap, tile.clip, tri.ti, tri.v);
+			break;
+		case DISPLAY_LIST_PUNCH_THROUGH:
+			pvr.render_tri<DISPLAY_LIST_PUNCH_THROUGH>(*tile.bitmap, tile.clip, tri.ti, tri.v);
+			break;
 		}
 	}
+	return nullptr;
 }
 
 void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect) {
@@ -2889,10 +2924,25 @@ void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const
 	uint32_t c=space.read_dword(0x05000000+(param_base&0xf00000)+((isp_backgnd_t&0xfffff8)>>1)+(3+3)*4);
 	bitmap.fill(c, cliprect);
 
+	// bin every triangle, keeping the list order within each tile
+	for (render_tile &tile : m_render_tiles) {
+		tile.bitmap = &bitmap;
+		tile.tris.clear();
+	}
+
 	// TODO: modifier volumes
-	render_group_to_accumulation_buffer<DISPLAY_LIST_OPAQUE>(bitmap, cliprect);
-	render_group_to_accumulation_buffer<DISPLAY_LIST_TRANS>(bitmap, cliprect);
-	render_group_to_accumulation_buffer<DISPLAY_LIST_PUNCH_THROUGH>(bitmap, cliprect);
+	bin_group_to_tiles<DISPLAY_LIST_OPAQUE>();
+	bin_group_to_tiles<DISPLAY_LIST_TRANS>();
+	bin_group_to_tiles<DISPLAY_LIST_PUNCH_THROUGH>();
+
+	// tiles don't overlap, so they can all be drawn at once
+	if (m_render_queue) {
+		osd_work_item_queue_multiple(m_render_queue, render_tile_callback, TILES_X * TILES_Y, m_render_tiles, sizeof(m_render_tiles[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(m_render_queue, osd_ticks_per_second() * 10);
+	} else {
+		for (render_tile &tile : m_render_tiles)
+			render_tile_callback(&tile, 0);
+	}
 
 	grab[renderselect].busy=0;
 }
@@ -3932,6 +3982,15 @@ void powervr2_device::device_start()
 
 	fake_accumulationbuffer_bitmap = std::make_unique<bitmap_rgb32>(2048,2048);
 
+	for (int ty = 0; ty < TILES_Y; ty++) {
+		for (int tx = 0; tx < TILES_X; tx++) {
+			render_tile &tile = m_render_tiles[ty * TILES_X + tx];
+			tile.pvr = this;
+			tile.clip.set(tx * TILE_SIZE, (tx + 1) * TILE_SIZE - 1, ty * TILE_SIZE, (ty + 1) * TILE_SIZE - 1);
+		}
+	}
+	m_render_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
 	softreset = 0;
 	param_base = 0;
 	region_base = 0;
@@ -4047,6 +4106,14 @@ void powervr2_device::device_start()
 	save_item(NAME(next_y));
 }
 
+void powervr2_device::device_stop()
+{
+	if (m_render_queue) {
+		osd_work_queue_free(m_render_queue);
+		m_render_queue = nullptr;
+	}
+}
+
 void powervr2_device::device_reset()
 {
 	softreset =                 0x00000007;
@@ -56,7 +56,7 @@ public:
 
 
 	// the real accumulation buffer is a 32x32x8bpp buffer into which tiles get rendered before they get copied to the framebuffer
-	//  our implementation is not currently tile based, and thus the accumulation buffer is screen sized
+	//  our implementation renders 32x32 tiles in parallel, but each one into its own area of a screen sized accumulation buffer
 	std::unique_ptr<bitmap_rgb32> fake_accumulationbuffer_bitmap;
 
 	/*
@@ -339,6 +339,7 @@ public:
 
 protected:
 	virtual void device_start() override;
+	virtual void device_stop() override;
 	virtual void device_reset() override;
 	ioport_constructor device_input_ports() const override;
 
@@ -384,6 +385,31 @@ private:
 
 	static uint32_t (*const blend_functions[64])(uint32_t s, uint32_t d);
 
+	// triangles are binned by the 32x32 tiles they touch, then each tile is drawn on its own
+	static constexpr int TILE_SIZE = 32;
+	static constexpr int TILES_X = 640 / TILE_SIZE;
+	static constexpr int TILES_Y = 480 / TILE_SIZE;
+
+	struct binned_tri
+	{
+		texinfo *ti;
+		const vert *v;
+		int group_no;
+	};
+
+	struct render_tile
+	{
+		powervr2_device *pvr = nullptr;
+		bitmap_rgb32 *bitmap = nullptr;
+		rectangle clip;
+		std::vector<binned_tri> tris;
+	};
+
+	osd_work_queue *m_render_queue = nullptr;
+	render_tile m_render_tiles[TILES_X * TILES_Y];
+
+	static int tile_for(float coord, int tiles);
+
 	static int uv_wrap(float uv, int size);
 	static int uv_flip(float uv, int size);
 	static int uv_clamp(float uv, int size);
@@ -504,7 +530,7 @@ private:
 	void tex_get_info(texinfo *t);
 
 	template <pix_sample_fn sample_fn, int group_no>
-		inline void render_hline(bitmap_rgb32 &bitmap, texinfo *ti,
+		inline void render_hline(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti,
 									int y, float xl, float xr,
 									float ul, float ur, float vl, float vr,
 									float wl, float wr,
@@ -512,7 +538,7 @@ private:
 									float const offl[4], float const offr[4]);
 
 	template <pix_sample_fn sample_fn, int group_no>
-		inline void render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+		inline void render_span(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti,
 								float y0, float y1,
 								float xl, float xr,
 								float ul, float ur,
@@ -528,15 +554,17 @@ private:
 								float const doldy[4], float const dordy[4]);
 
 	template <pix_sample_fn sample_fn, int group_no>
-		inline void render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti,
+		inline void render_tri_sorted(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti,
 										const vert *v0,
 										const vert *v1, const vert *v2);
 
 	template <int group_no>
-		void render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v);
+		void render_tri(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, const vert *v);
 
 	template <int group_no>
-		void render_group_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
+		void bin_group_to_tiles();
+
+	static void *render_tile_callback(void *param, int threadid);
 
 	void sort_vertices(const vert *v, int *i0, int *i1, int *i2);
 	void render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
@@ -953,8 +953,8 @@ template <bool is_pal> void sat_console_state::init_saturn()
 	m_vdp2.pal = is_pal;
 
 	// set compatible options
-	m_maincpu->sh2drc_set_options(SH2DRC_STRICT_VERIFY|SH2DRC_STRICT_PCREL);
-	m_slave->sh2drc_set_options(SH2DRC_STRICT_VERIFY|SH2DRC_STRICT_PCREL);
+	m_maincpu->sh2drc_set_options(SH2DRC_STRICT_VERIFY|SH2DRC_STRICT_PCREL|SH2DRC_BRANCH_CYCLES|SH2DRC_IDLE_LOOPS);
+	m_slave->sh2drc_set_options(SH2DRC_STRICT_VERIFY|SH2DRC_STRICT_PCREL|SH2DRC_BRANCH_CYCLES|SH2DRC_IDLE_LOOPS);
 
 	m_maincpu->sh2drc_add_fastram(0x00000000, 0x0007ffff, 1, &m_rom[0]);
 	m_maincpu->sh2drc_add_fastram(0x00200000, 0x002fffff, 0, &m_workram_l[0]);
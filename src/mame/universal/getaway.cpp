@@ -390,6 +390,7 @@ void getaway_state::getaway(machine_config &config)
 	m_screen->set_size(32*8, 32*8);
 	m_screen->set_visarea(1*8, 32*8-1, 0*8, 30*8-1);
 	m_screen->set_screen_update(FUNC(getaway_state::screen_update));
+	m_screen->set_video_attributes(VIDEO_UPDATE_THREADSAFE);
 	m_screen->screen_vblank().set(FUNC(getaway_state::vblank_irq));
 	m_screen->set_palette("palette");
 
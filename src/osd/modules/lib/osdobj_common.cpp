@@ -74,6 +74,8 @@ const options_entry osd_options::s_option_entries[] =
 	{ OSDOPTION_MAXIMIZE ";max",                 "1",              core_options::option_type::BOOLEAN,   "default to maximized windows" },
 	{ OSDOPTION_WAITVSYNC ";vs",                 "0",              core_options::option_type::BOOLEAN,   "enable waiting for the start of VBLANK before flipping screens (reduces tearing effects)" },
 	{ OSDOPTION_SYNC_MODE "(0-4)",               "2",              core_options::option_type::INTEGER,   "sync mode"},
+	{ OSDOPTION_CAPTURE_NAME,                    "mame_capture",   core_options::option_type::STRING,    "shared memory object that -video capture writes frames to" },
+	{ OSDOPTION_CAPTURE_FRAMES "(2-64)",         "4",              core_options::option_type::INTEGER,   "number of frames in the -video capture shared memory ring" },
 	{ OSD_MONITOR_PROVIDER,                      OSDOPTVAL_AUTO,   core_options::option_type::STRING,    "monitor discovery method: " },
 
 	// per-window options
@@ -295,6 +297,7 @@ void osd_common_t::register_options()
 #if !defined(SDLMAME_EMSCRIPTEN)
 	REGISTER_MODULE(m_mod_man, RENDERER_SDL1);
 #endif
+	REGISTER_MODULE(m_mod_man, RENDERER_CAPTURE);
 	REGISTER_MODULE(m_mod_man, RENDERER_NONE);
 
 	REGISTER_MODULE(m_mod_man, SOUND_DSOUND);
@@ -58,6 +58,8 @@
 #define OSDOPTION_MAXIMIZE              "maximize"
 #define OSDOPTION_WAITVSYNC             "waitvsync"
 #define OSDOPTION_SYNC_MODE             "sync_mode"
+#define OSDOPTION_CAPTURE_NAME          "capture_name"
+#define OSDOPTION_CAPTURE_FRAMES        "capture_frames"
 
 #define OSDOPTION_SCREEN                "screen"
 #define OSDOPTION_ASPECT                "aspect"
@@ -167,6 +169,8 @@ public:
 	bool maximize() const { return bool_value(OSDOPTION_MAXIMIZE); }
 	bool wait_vsync() const { return bool_value(OSDOPTION_WAITVSYNC); }
 	int sync_mode() const { return int_value(OSDOPTION_SYNC_MODE); }
+	const char *capture_name() const { return value(OSDOPTION_CAPTURE_NAME); }
+	int capture_frames() const { return int_value(OSDOPTION_CAPTURE_FRAMES); }
 
 	// per-window options
 	const char *screen() const { return value(OSDOPTION_SCREEN); }
@@ -0,0 +1,331 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+//============================================================
+//
+//  drawcapture.cpp - headless shared memory frame capture
+//
+//  Draws the final primitive list with the software renderer
+//  directly into a ring of frames in a named shared memory
+//  object.  See drawcapture.h for the layout.
+//
+//============================================================
+
+#include "render_module.h"
+#include "drawcapture.h"
+
+#include "modules/lib/osdobj_common.h"
+#include "modules/osdmodule.h"
+#include "modules/osdwindow.h"
+
+// emu
+#include "emu.h"
+#include "render.h"
+#include "rendersw.hxx"
+#include "screen.h"
+
+#include "strformat.h"
+
+#if defined(_WIN32)
+#include "strconv.h"
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+
+
+namespace osd {
+
+namespace {
+
+//============================================================
+//  shared_frame_ring - owns the mapping
+//============================================================
+
+class shared_frame_ring
+{
+public:
+	shared_frame_ring() = default;
+	shared_frame_ring(shared_frame_ring const &) = delete;
+	shared_frame_ring &operator=(shared_frame_ring const &) = delete;
+	~shared_frame_ring() { close(); }
+
+	bool open(std::string const &name, u32 width, u32 height, u32 slots);
+	void close();
+
+	bool is_open() const { return m_base != nullptr; }
+	capture_ring_header &header() const { return *reinterpret_cast<capture_ring_header *>(m_base); }
+	capture_slot_header &slot(u64 frame) const { return *reinterpret_cast<capture_slot_header *>(slot_base(frame)); }
+	u32 *pixels(u64 frame) const { return reinterpret_cast<u32 *>(slot_base(frame) + header().pixel_offset); }
+
+private:
+	u8 *slot_base(u64 frame) const
+	{
+		capture_ring_header const &ring = header();
+		return m_base + ring.header_size + size_t(frame % ring.slot_count) * ring.slot_stride;
+	}
+
+	u8 *        m_base = nullptr;
+	size_t      m_size = 0;
+	std::string m_name;
+#if defined(_WIN32)
+	HANDLE      m_mapping = nullptr;
+#endif
+};
+
+
+bool shared_frame_ring::open(std::string const &name, u32 width, u32 height, u32 slots)
+{
+	// keep slots and pixel rows 64-byte aligned so consumers can use wide loads
+	u32 const pitch = (width + 15) & ~15;
+	size_t const headersize = (sizeof(capture_ring_header) + 63) & ~size_t(63);
+	size_t const pixeloffset = (sizeof(capture_slot_header) + 63) & ~size_t(63);
+	size_t const stride = pixeloffset + size_t(pitch) * height * sizeof(u32);
+	size_t const size = headersize + stride * slots;
+	if (stride > 0xffffffffU)
+		return false;
+
+	close();
+
+#if defined(_WIN32)
+	std::wstring const wname = osd::text::to_wstring(name);
+	m_mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, DWORD(u64(size) >> 32), DWORD(size), wname.c_str());
+	if (!m_mapping)
+		return false;
+	m_base = reinterpret_cast<u8 *>(MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size));
+	if (!m_base)
+	{
+		CloseHandle(m_mapping);
+		m_mapping = nullptr;
+		return false;
+	}
+#else
+	// POSIX shared memory names need a single leading slash
+	m_name = (name[0] == '/') ? name : ('/' + name);
+	int const fd = shm_open(m_name.c_str(), O_RDWR | O_CREAT, 0600);
+	if (fd < 0)
+		return false;
+	if (ftruncate(fd, off_t(size)) != 0)
+	{
+		::close(fd);
+		shm_unlink(m_name.c_str());
+		return false;
+	}
+	void *const base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (base == MAP_FAILED)
+	{
+		shm_unlink(m_name.c_str());
+		return false;
+	}
+	m_base = reinterpret_cast<u8 *>(base);
+#endif
+	m_size = size;
+
+	// a reused object may hold stale frames; mark every slot empty before publishing the header
+	capture_ring_header &ring = *new (m_base) capture_ring_header();
+	ring.header_size = headersize;
+	ring.slot_count = slots;
+	ring.slot_stride = stride;
+	ring.pixel_offset = pixeloffset;
+	for (u32 index = 0; index < slots; index++)
+		new (slot_base(index)) capture_slot_header();
+	ring.version = CAPTURE_RING_VERSION;
+	ring.format = CAPTURE_FORMAT_XRGB8888;
+	ring.width = width;
+	ring.height = height;
+	ring.pitch = pitch;
+	std::atomic_thread_fence(std::memory_order_release);
+	std::memcpy(ring.magic, CAPTURE_RING_MAGIC, sizeof(ring.magic));
+	return true;
+}
+
+
+void shared_frame_ring::close()
+{
+	if (!m_base)
+		return;
+
+#if defined(_WIN32)
+	UnmapViewOfFile(m_base);
+	CloseHandle(m_mapping);
+	m_mapping = nullptr;
+#else
+	munmap(m_base, m_size);
+	shm_unlink(m_name.c_str());
+#endif
+	m_base = nullptr;
+	m_size = 0;
+}
+
+
+//============================================================
+//  renderer_capture
+//============================================================
+
+class renderer_capture : public osd_renderer
+{
+public:
+	renderer_capture(osd_window &window, std::string &&name, u32 slots)
+		: osd_renderer(window)
+		, m_name(std::move(name))
+		, m_slots(slots)
+		, m_frame(0)
+		, m_work_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ))
+	{
+	}
+
+	virtual ~renderer_capture()
+	{
+		if (m_work_queue)
+			osd_work_queue_free(m_work_queue);
+	}
+
+	virtual int create() override;
+	virtual render_primitive_list *get_primitives() override;
+	virtual int draw(const int update) override;
+	virtual void save() override { }
+	virtual void record() override { }
+	virtual void toggle_fsfx() override { }
+
+private:
+	std::string         m_name;
+	u32                 m_slots;
+	u32                 m_width = 0;
+	u32                 m_height = 0;
+	u64                 m_frame;
+	shared_frame_ring   m_ring;
+	osd_work_queue *    m_work_queue;
+};
+
+//============================================================
+//  renderer_capture::create
+//============================================================
+
+int renderer_capture::create()
+{
+	// the capture size is fixed for the life of the mapping
+	osd_dim const dimensions = window().get_size();
+	if ((dimensions.width() <= 0) || (dimensions.height() <= 0))
+	{
+		osd_printf_error("Capture: invalid window size %dx%d\n", dimensions.width(), dimensions.height());
+		return 1;
+	}
+	m_width = dimensions.width();
+	m_height = dimensions.height();
+
+	// secondary windows get their own object
+	if (window().index() > 0)
+		m_name += util::string_format("%d", window().index());
+
+	if (!m_ring.open(m_name, m_width, m_height, m_slots))
+	{
+		osd_printf_error("Capture: unable to create shared memory object %s for %u %ux%u frames\n", m_name, m_slots, m_width, m_height);
+		return 1;
+	}
+
+	osd_printf_verbose("Capture: writing %u %ux%u frames to shared memory object %s\n", m_slots, m_width, m_height, m_name);
+	return 0;
+}
+
+//============================================================
+//  renderer_capture::get_primitives
+//============================================================
+
+render_primitive_list *renderer_capture::get_primitives()
+{
+	if (!m_ring.is_open())
+		return nullptr;
+
+	window().target()->set_bounds(m_width, m_height, window().pixel_aspect());
+	return &window().target()->get_primitives();
+}
+
+//============================================================
+//  renderer_capture::draw
+//============================================================
+
+int renderer_capture::draw(const int update)
+{
+	if (!m_ring.is_open())
+		return 1;
+
+	// claim the next slot; readers holding it see an odd sequence and drop their copy
+	u64 const frame = ++m_frame;
+	capture_slot_header &slot = m_ring.slot(frame);
+	slot.sequence.store(frame * 2 - 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	// draw the primitives straight into shared memory
+	u32 *const dst = m_ring.pixels(frame);
+	window().m_primlist->acquire_lock();
+	software_renderer<u32, 0,0,0, 16,8,0>::draw_primitives(*window().m_primlist, dst, m_width, m_height, m_ring.header().pitch, m_work_queue);
+	window().m_primlist->release_lock();
+
+	// fill in the frame info and publish it
+	running_machine &machine = window().machine();
+	screen_device const *const screen = screen_device_enumerator(machine.root_device()).first();
+	attotime const now = machine.time();
+	slot.frame_number = screen ? screen->frame_number() : frame;
+	slot.time_seconds = now.seconds();
+	slot.time_attoseconds = now.attoseconds();
+	slot.sequence.store(frame * 2, std::memory_order_release);
+	m_ring.header().write_sequence.store(frame, std::memory_order_release);
+
+	return 0;
+}
+
+
+//============================================================
+//  video_capture
+//============================================================
+
+class video_capture : public osd_module, public render_module
+{
+public:
+	video_capture() : osd_module(OSD_RENDERER_PROVIDER, "capture"), m_slots(0) { }
+
+	virtual int init(osd_interface &osd, osd_options const &options) override;
+	virtual void exit() override { }
+
+	virtual std::unique_ptr<osd_renderer> create(osd_window &window) override;
+
+protected:
+	virtual unsigned flags() const override { return 0; }
+
+private:
+	std::string m_name;
+	u32         m_slots;
+};
+
+int video_capture::init(osd_interface &osd, osd_options const &options)
+{
+	m_name = options.capture_name();
+	m_slots = std::clamp(options.capture_frames(), 2, 64);
+	if (m_name.empty())
+	{
+		osd_printf_error("Capture: -%s must name a shared memory object\n", OSDOPTION_CAPTURE_NAME);
+		return -1;
+	}
+
+	return 0;
+}
+
+std::unique_ptr<osd_renderer> video_capture::create(osd_window &window)
+{
+	return std::make_unique<renderer_capture>(window, std::string(m_name), m_slots);
+}
+
+} // anonymous namespace
+
+} // namespace osd
+
+
+MODULE_DEFINITION(RENDERER_CAPTURE, osd::video_capture)
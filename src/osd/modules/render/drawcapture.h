@@ -0,0 +1,75 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+//============================================================
+//
+//  drawcapture.h - shared memory frame ring layout
+//
+//  The capture renderer draws every frame straight into a
+//  named shared memory object.  Other processes map the same
+//  object read-only and pick frames out of it without any
+//  encoding step.  This header describes the layout and is
+//  self-contained so consumers can include it directly.
+//
+//  The object starts with a capture_ring_header, followed by
+//  slot_count slots spaced slot_stride bytes apart.  Each slot
+//  is a capture_slot_header followed by the pixel data, which
+//  starts pixel_offset bytes into the slot.
+//
+//  Frame N (starting at 1) goes into slot N % slot_count.
+//  While it is drawn, the slot sequence is 2N-1; once it is
+//  complete the sequence becomes 2N and the ring's
+//  write_sequence is set to N.  A reader reads the slot
+//  sequence, copies the header and pixels, then reads the
+//  sequence again; if either value is odd or they differ,
+//  the frame was overwritten and must be dropped.
+//
+//============================================================
+#ifndef MAME_OSD_MODULES_RENDER_DRAWCAPTURE_H
+#define MAME_OSD_MODULES_RENDER_DRAWCAPTURE_H
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace osd {
+
+constexpr char CAPTURE_RING_MAGIC[8] = { 'M', 'A', 'M', 'E', 'C', 'A', 'P', '1' };
+constexpr std::uint32_t CAPTURE_RING_VERSION = 1;
+
+// pixel formats
+enum : std::uint32_t
+{
+	CAPTURE_FORMAT_XRGB8888 = 0                     // 32-bit little-endian words, 0x00RRGGBB
+};
+
+struct capture_ring_header
+{
+	char                        magic[8];           // CAPTURE_RING_MAGIC
+	std::uint32_t               version;            // CAPTURE_RING_VERSION
+	std::uint32_t               header_size;        // sizeof(capture_ring_header)
+	std::uint32_t               slot_count;         // number of frame slots
+	std::uint32_t               slot_stride;        // bytes from one slot to the next
+	std::uint32_t               pixel_offset;       // bytes from slot start to first pixel
+	std::uint32_t               format;             // CAPTURE_FORMAT_*
+	std::uint32_t               width;              // frame width in pixels
+	std::uint32_t               height;             // frame height in pixels
+	std::uint32_t               pitch;              // row pitch in pixels
+	std::uint32_t               reserved;
+	std::atomic<std::uint64_t>  write_sequence;     // last completed frame number, 0 if none
+};
+
+struct capture_slot_header
+{
+	std::atomic<std::uint64_t>  sequence;           // 2N-1 while frame N is drawn, 2N once complete
+	std::uint64_t               frame_number;       // emulated frame number from the video manager
+	std::int64_t                time_seconds;       // emulated time of the frame
+	std::int64_t                time_attoseconds;
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "capture ring requires lock-free 64-bit atomics");
+
+} // namespace osd
+
+#endif // MAME_OSD_MODULES_RENDER_DRAWCAPTURE_H
@@ -34,9 +34,16 @@ public:
 		: osd_renderer(window)
 		, m_bmdata(nullptr)
 		, m_bmsize(0)
+		, m_work_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ))
 	{
 	}
 
+	virtual ~renderer_gdi()
+	{
+		if (m_work_queue)
+			osd_work_queue_free(m_work_queue);
+	}
+
 	virtual int create() override;
 	virtual render_primitive_list *get_primitives() override;
 	virtual int draw(const int update) override;
@@ -48,6 +55,7 @@ private:
 	BITMAPINFO                  m_bminfo;
 	std::unique_ptr<uint8_t []> m_bmdata;
 	size_t                      m_bmsize;
+	osd_work_queue *            m_work_queue;
 };
 
 //============================================================
@@ -116,7 +124,7 @@ int renderer_gdi::draw(const int update)
 
 	// draw the primitives to the bitmap
 	win.m_primlist->acquire_lock();
-	software_renderer<uint32_t, 0,0,0, 16,8,0>::draw_primitives(*win.m_primlist, m_bmdata.get(), width, height, pitch);
+	software_renderer<uint32_t, 0,0,0, 16,8,0>::draw_primitives(*win.m_primlist, m_bmdata.get(), width, height, pitch, m_work_queue);
 	win.m_primlist->release_lock();
 
 	// fill in bitmap-specific info
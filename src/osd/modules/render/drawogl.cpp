@@ -351,7 +351,7 @@ private:
 
 	int gl_checkFramebufferStatus() const;
 	int texture_fbo_create(uint32_t text_unit, uint32_t text_name, uint32_t fbo_name, int width, int height) const;
-	void texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags) const;
+	void texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags, uint32_t cachedseq) const;
 
 	int gl_check_error(bool log, const char *file, int line) const
 	{
@@ -2541,12 +2541,45 @@ static inline void copyline_yuy16_to_argb(uint32_t *dst, const uint16_t *src, in
 	}
 }
 
+//============================================================
+//  texture_upload_rows
+//============================================================
+
+static void texture_upload_rows(ogl_texture_info *texture, bool partial, uint32_t top, uint32_t bottom)
+{
+	if (!partial)
+	{
+		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
+						GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+		return;
+	}
+
+	// only the texels built from the changed source rows; the border rows never change
+	if (top > bottom)
+		return;
+	int const y = top * texture->yprescale + texture->borderpix;
+	int const height = (bottom - top + 1) * texture->yprescale;
+	int const pitch = texture->nocopy ? texture->texinfo.rowpixels : texture->rawwidth;
+	glTexSubImage2D(texture->texTarget, 0, 0, y, texture->rawwidth, height,
+					GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data + y * pitch);
+}
+
 //============================================================
 //  texture_set_data
 //============================================================
 
-void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags) const
+void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags, uint32_t cachedseq) const
 {
+	// work out which source rows changed since the copy we hold; the PBO is mapped write-only,
+	// so dynamic textures always get a full update
+	uint32_t top, bottom;
+	bool const partial = (texture->type != TEXTURE_TYPE_DYNAMIC) && texsource->changed_rows(cachedseq, top, bottom);
+	if (!partial)
+	{
+		top = 0;
+		bottom = texsource->height - 1;
+	}
+
 	if ( texture->type == TEXTURE_TYPE_DYNAMIC )
 	{
 		assert(texture->pbo);
@@ -2564,7 +2597,7 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 	}
 
 	// always fill non-wrapping textures with an extra pixel on the top
-	if (texture->borderpix)
+	if (texture->borderpix && !partial)
 	{
 		memset(texture->data, 0,
 				(texsource->width * texture->xprescale + 2) * sizeof(uint32_t));
@@ -2576,7 +2609,7 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 		int y, y2;
 		uint8_t *dst;
 
-		for (y = 0; y < texsource->height; y++)
+		for (y = top; y <= int(bottom); y++)
 		{
 			for (y2 = 0; y2 < texture->yprescale; y2++)
 			{
@@ -2609,7 +2642,7 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 	}
 
 	// always fill non-wrapping textures with an extra pixel on the bottom
-	if (texture->borderpix)
+	if (texture->borderpix && !partial)
 	{
 		memset((uint8_t *)texture->data +
 				(texsource->height + 1) * texture->rawwidth * sizeof(uint32_t),
@@ -2628,8 +2661,7 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->rawwidth);
 
 		// and upload the image
-		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
-				GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+		texture_upload_rows(texture, partial, top, bottom);
 	}
 	else if ( texture->type == TEXTURE_TYPE_DYNAMIC )
 	{
@@ -2655,8 +2687,7 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->rawwidth);
 
 		// and upload the image
-		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
-						GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+		texture_upload_rows(texture, partial, top, bottom);
 	}
 }
 
@@ -2918,10 +2949,11 @@ ogl_texture_info * renderer_ogl::texture_update(const render_primitive *prim, in
 		{
 			if (prim->texture.base != nullptr && texture->texinfo.seqid != prim->texture.seqid)
 			{
+				uint32_t const cachedseq = texture->texinfo.seqid;
 				texture->texinfo.seqid = prim->texture.seqid;
 
 				// if we found it, but with a different seqid, copy the data
-				texture_set_data(texture, &prim->texture, prim->flags);
+				texture_set_data(texture, &prim->texture, prim->flags, cachedseq);
 				texBound=1;
 			}
 		}
@@ -2,6 +2,9 @@
 #include "emucore.h"
 #include "video/rgbutil.h"
 
+#include <algorithm>
+#include <iterator>
+
 
 //-------------------------------------------------
 //  random_u64
@@ -1034,3 +1037,74 @@ TEST_CASE("check rgb", "[emu][video]")
 		check_expected();
 	}
 }
+
+
+TEST_CASE("check rgb spans", "[emu][video]")
+{
+	// span helpers must match rgbaint_t exactly whichever implementation the host picked
+	INFO("AVX2 span helpers " << (rgb_wide_avx2_active() ? "active" : "inactive"));
+
+	// odd length so the paired body and the single-pixel tail both get used
+	constexpr int COUNT = 37;
+	u32 src[COUNT], other[COUNT], actual[COUNT];
+	u32 seed = 12345;
+	for (int i = 0; i < COUNT; i++)
+	{
+		seed = seed * 1664525U + 1013904223U;
+		src[i] = seed;
+		seed = seed * 1664525U + 1013904223U;
+		other[i] = seed;
+	}
+
+	SECTION("rgb_blend_span")
+	{
+		for (int factor : { 0x00, 0x01, 0x80, 0xff })
+		{
+			rgb_blend_span(actual, src, other, COUNT, factor);
+			for (int i = 0; i < COUNT; i++)
+			{
+				rgbaint_t p(src[i]);
+				p.blend(rgbaint_t(other[i]), factor);
+				REQUIRE(actual[i] == u32(p.to_rgba()));
+			}
+		}
+	}
+
+	SECTION("rgb_scale_span")
+	{
+		rgbaint_t const scale(0x100, 0x80, 0x1ff, 0x40);
+		rgb_scale_span(actual, src, COUNT, scale);
+		for (int i = 0; i < COUNT; i++)
+		{
+			rgbaint_t p(src[i]);
+			p.scale_and_clamp(scale);
+			REQUIRE(actual[i] == u32(p.to_rgba()));
+		}
+	}
+
+	SECTION("rgb_scale_span in place")
+	{
+		rgbaint_t const scale(0, 0x180, 0x100, 0xc0);
+		std::copy(std::begin(src), std::end(src), std::begin(actual));
+		rgb_scale_span(actual, actual, COUNT, scale);
+		for (int i = 0; i < COUNT; i++)
+		{
+			rgbaint_t p(src[i]);
+			p.scale_and_clamp(scale);
+			REQUIRE(actual[i] == u32(p.to_rgba()));
+		}
+	}
+
+	SECTION("rgb_scale_add_span")
+	{
+		rgbaint_t const scale(0x100, 0x80, 0x1ff, 0x40);
+		rgbaint_t const add(0, 0x20, -0x10, 0x7f);
+		rgb_scale_add_span(actual, src, COUNT, scale, add);
+		for (int i = 0; i < COUNT; i++)
+		{
+			rgbaint_t p(src[i]);
+			p.scale_add_and_clamp(scale, add);
+			REQUIRE(actual[i] == u32(p.to_rgba()));
+		}
+	}
+}
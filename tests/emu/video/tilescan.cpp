@@ -0,0 +1,152 @@
+#include "catch.hpp"
+#include "emucore.h"
+#include "video/tilescan.h"
+
+#include <vector>
+
+
+namespace {
+
+//-------------------------------------------------
+//  scanline_fixture - source, mask, palette and
+//  two copies of each destination, one for the
+//  reference code and one for the optimised code
+//-------------------------------------------------
+
+struct scanline_fixture
+{
+	// odd length and offset so both the vector body and the tail get used
+	static constexpr int COUNT = 16 * 7 + 11;
+	static constexpr int START = 3;
+
+	scanline_fixture()
+		: source(COUNT + START)
+		, maskptr(COUNT + START)
+		, pens(0x1000)
+		, ref16(COUNT + START), opt16(COUNT + START)
+		, ref32(COUNT + START), opt32(COUNT + START)
+		, refpri(COUNT + START), optpri(COUNT + START)
+	{
+		for (auto &p : pens)
+			p = rgb_t(random_u32());
+		for (int i = 0; i < COUNT + START; i++)
+		{
+			source[i] = random_u32() & 0x7ff;
+			ref16[i] = opt16[i] = random_u32();
+			ref32[i] = opt32[i] = random_u32();
+			refpri[i] = optpri[i] = random_u32();
+		}
+
+		// runs of fully opaque, fully transparent and mixed 16-pixel groups
+		for (int i = 0; i < COUNT + START; i++)
+		{
+			switch ((i / 16) % 3)
+			{
+			case 0: maskptr[i] = 0x15; break;
+			case 1: maskptr[i] = 0x20; break;
+			default: maskptr[i] = random_u32(); break;
+			}
+		}
+	}
+
+	// fixed LCG so every run tests the same data; the halves are swapped
+	// because the low bits of an LCG repeat with a very short period
+	u32 random_u32()
+	{
+		seed = seed * 1664525U + 1013904223U;
+		return (seed >> 16) | (seed << 16);
+	}
+
+	void check()
+	{
+		for (int i = 0; i < COUNT + START; i++)
+		{
+			REQUIRE(ref16[i] == opt16[i]);
+			REQUIRE(ref32[i] == opt32[i]);
+			REQUIRE(refpri[i] == optpri[i]);
+		}
+	}
+
+	u32 seed = 12345;
+	std::vector<u16> source;
+	std::vector<u8> maskptr;
+	std::vector<rgb_t> pens;
+	std::vector<u16> ref16, opt16;
+	std::vector<u32> ref32, opt32;
+	std::vector<u8> refpri, optpri;
+};
+
+// palette offset plus priority update, plain palette offset with no priority update, and no offset
+const u32 pcodes[] = { 0x0300f102, 0x0400ff00, 0x0000c080, 0x0000ff00 };
+
+// matching the fixture's opaque runs, matching nothing, a value the mask can never produce
+const int masks[][2] = { { 0x1f, 0x15 }, { 0x01, 0x01 }, { 0x0f, 0x30 }, { 0x3ff, 0x115 } };
+
+} // anonymous namespace
+
+
+TEST_CASE("tilemap scanline opaque", "[emu][video]")
+{
+	using namespace emu::tilescan;
+
+	for (u32 pcode : pcodes)
+	{
+		scanline_fixture f;
+		int const s = scanline_fixture::START;
+		int const n = scanline_fixture::COUNT;
+
+		opaque_null_generic(n, &f.refpri[s], pcode);
+		opaque_null(n, &f.optpri[s], pcode);
+		f.check();
+
+		opaque_ind16_generic(&f.ref16[s], &f.source[s], n, &f.refpri[s], pcode);
+		opaque_ind16(&f.opt16[s], &f.source[s], n, &f.optpri[s], pcode);
+		f.check();
+
+		opaque_rgb32_generic(&f.ref32[s], &f.source[s], n, &f.pens[0], &f.refpri[s], pcode);
+		opaque_rgb32(&f.opt32[s], &f.source[s], n, &f.pens[0], &f.optpri[s], pcode);
+		f.check();
+
+		for (int alpha : { 0x00, 0x40, 0x80, 0xff })
+		{
+			opaque_rgb32_alpha_generic(&f.ref32[s], &f.source[s], n, &f.pens[0], &f.refpri[s], pcode, alpha);
+			opaque_rgb32_alpha(&f.opt32[s], &f.source[s], n, &f.pens[0], &f.optpri[s], pcode, alpha);
+			f.check();
+		}
+	}
+}
+
+
+TEST_CASE("tilemap scanline masked", "[emu][video]")
+{
+	using namespace emu::tilescan;
+
+	for (u32 pcode : pcodes)
+	{
+		for (auto const &m : masks)
+		{
+			scanline_fixture f;
+			int const s = scanline_fixture::START;
+			int const n = scanline_fixture::COUNT;
+
+			masked_null_generic(&f.maskptr[s], m[0], m[1], n, &f.refpri[s], pcode);
+			masked_null(&f.maskptr[s], m[0], m[1], n, &f.optpri[s], pcode);
+			f.check();
+
+			masked_ind16_generic(&f.ref16[s], &f.source[s], &f.maskptr[s], m[0], m[1], n, &f.refpri[s], pcode);
+			masked_ind16(&f.opt16[s], &f.source[s], &f.maskptr[s], m[0], m[1], n, &f.optpri[s], pcode);
+			f.check();
+
+			masked_rgb32_generic(&f.ref32[s], &f.source[s], &f.maskptr[s], m[0], m[1], n, &f.pens[0], &f.refpri[s], pcode);
+			masked_rgb32(&f.opt32[s], &f.source[s], &f.maskptr[s], m[0], m[1], n, &f.pens[0], &f.optpri[s], pcode);
+			f.check();
+
+			for (int alpha : { 0x00, 0x40, 0x80, 0xff })
+			{
+				masked_rgb32_alpha_generic(&f.ref32[s], &f.source[s], &f.maskptr[s], m[0], m[1], n, &f.pens[0], &f.refpri[s], pcode, alpha);
+				masked_rgb32_alpha(&f.opt32[s], &f.source[s], &f.maskptr[s], m[0], m[1], n, &f.pens[0], &f.optpri[s], pcode, alpha);
+				f.check();
+			}
+		}
+	}
+}
@@ -0,0 +1,140 @@
+#include "catch.hpp"
+
+#include "palette.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+
+namespace {
+
+//-------------------------------------------------
+//  reference_adjust - the per-entry adjustment,
+//  written out the long way
+//-------------------------------------------------
+
+rgb_t reference_adjust(rgb_t raw, float brightness, float contrast, float gamma)
+{
+	auto const channel = [brightness, contrast, gamma] (std::uint8_t value)
+	{
+		std::uint8_t const mapped = rgb_t::clamp(255.0f * std::pow(float(value) * (1.0f / 255.0f), 1.0f / gamma));
+		return rgb_t::clamp(float(mapped) * contrast + brightness);
+	};
+	return rgb_t(raw.a(), channel(raw.r()), channel(raw.g()), channel(raw.b()));
+}
+
+
+//-------------------------------------------------
+//  check_adjusted - compare every adjusted entry
+//  against the reference
+//-------------------------------------------------
+
+void check_adjusted(palette_t &palette, float brightness, float contrast, float gamma, float const *groupbright, float const *groupcontrast, float const *entrycontrast)
+{
+	palette.update();
+	rgb_t const *const adjusted = palette.entry_list_adjusted();
+	rgb_t const *const adjusted15 = palette.entry_list_adjusted_rgb15();
+	for (int group = 0; group < palette.num_groups(); group++)
+		for (int index = 0; index < palette.num_colors(); index++)
+		{
+			rgb_t const expected = reference_adjust(
+					palette.entry_color(index),
+					(groupbright[group] - 1.0f) * 256.0f + (brightness - 1.0f) * 256.0f,
+					groupcontrast[group] * entrycontrast[index] * contrast,
+					gamma);
+			int const finalindex = group * palette.num_colors() + index;
+			REQUIRE(adjusted[finalindex] == expected);
+			REQUIRE(adjusted15[finalindex] == expected.as_rgb15());
+		}
+}
+
+} // anonymous namespace
+
+
+TEST_CASE("Palette adjusted colors follow raw colors and adjustments", "[util]")
+{
+	// an odd size so both the batched and the leftover paths are used
+	int const colors = 1027;
+	float groupbright[2] = { 1.0f, 0.875f };
+	float const groupcontrast[2] = { 1.0f, 0.6f };
+	float entrycontrast[colors];
+
+	palette_t *const palette = palette_t::alloc(colors, 2);
+	palette->group_set_brightness(1, groupbright[1]);
+	palette->group_set_contrast(1, groupcontrast[1]);
+	for (int index = 0; index < colors; index++)
+	{
+		palette->entry_set_color(index, rgb_t(index & 0xff, (index * 7) & 0xff, (index >> 2) & 0xff, (index * 13) & 0xff));
+		entrycontrast[index] = (index % 5) ? 1.0f : 1.25f;
+		palette->entry_set_contrast(index, entrycontrast[index]);
+	}
+	check_adjusted(*palette, 1.0f, 1.0f, 1.0f, groupbright, groupcontrast, entrycontrast);
+
+	palette->set_brightness(1.1f);
+	palette->set_contrast(0.9f);
+	palette->set_gamma(1.4f);
+	check_adjusted(*palette, 1.1f, 0.9f, 1.4f, groupbright, groupcontrast, entrycontrast);
+
+	// rewrite part of the palette, as a fade would
+	for (int index = 100; index < 600; index++)
+		palette->entry_set_color(index, rgb_t(palette->entry_color(index)).scale8(0x80));
+	check_adjusted(*palette, 1.1f, 0.9f, 1.4f, groupbright, groupcontrast, entrycontrast);
+
+	// scattered writes, including runs that cross bitmap words, alongside a group change
+	for (int index = 5; index < colors; index += 37)
+		palette->entry_set_color(index, rgb_t(index & 0xff, 0x40, 0x80, 0xc0));
+	for (int index = 30; index < 34; index++)
+		palette->entry_set_color(index, rgb_t(0x10, 0x20, 0x30));
+	palette->entry_set_color(colors - 1, rgb_t::white());
+	groupbright[1] = 0.75f;
+	palette->group_set_brightness(1, groupbright[1]);
+	check_adjusted(*palette, 1.1f, 0.9f, 1.4f, groupbright, groupcontrast, entrycontrast);
+
+	palette->deref();
+}
+
+TEST_CASE("Palette clients see entries changed by batched updates", "[util]")
+{
+	palette_t *const palette = palette_t::alloc(256, 1);
+	{
+		palette_client client(*palette);
+		std::uint32_t mindirty, maxdirty;
+		client.dirty_list(mindirty, maxdirty);
+		REQUIRE(!client.dirty_list(mindirty, maxdirty));
+
+		palette->entry_set_color(17, rgb_t(1, 2, 3));
+		palette->entry_set_color(201, rgb_t(4, 5, 6));
+		palette->entry_set_color(202, rgb_t::black());
+		std::uint32_t const *const dirty = client.dirty_list(mindirty, maxdirty);
+		REQUIRE(dirty);
+		REQUIRE(mindirty == 17);
+		REQUIRE(maxdirty == 201);
+		REQUIRE(dirty[17 / 32] == (1U << (17 % 32)));
+		REQUIRE(dirty[201 / 32] == (1U << (201 % 32)));
+		REQUIRE(palette->entry_adjusted_color(201) == rgb_t(4, 5, 6));
+	}
+	palette->deref();
+}
+
+TEST_CASE("Palette reads back colors set since the last update", "[util]")
+{
+	// the pattern used by per-scanline palette writes: set an entry, then read its pen straight back
+	palette_t *const palette = palette_t::alloc(64, 2);
+	palette->group_set_brightness(1, 0.5f);
+	palette->update();
+	REQUIRE(!palette->pending());
+	for (int line = 0; line < 16; line++)
+	{
+		rgb_t const color(line * 16, 0xff - line, line);
+		palette->entry_set_color(line, color);
+		REQUIRE(palette->pending());
+
+		// device_palette_interface::pen() does this on the main thread whenever changes are pending
+		palette->update();
+		REQUIRE(!palette->pending());
+		REQUIRE(palette->entry_adjusted_color(line) == color);
+		REQUIRE(palette->entry_adjusted_color(64 + line) == reference_adjust(color, 0.5f * 256.0f - 256.0f, 1.0f, 1.0f));
+	}
+	palette->deref();
+}
@@ -0,0 +1,93 @@
+#include "catch.hpp"
+
+#include "png.h"
+
+#include "ioprocs.h"
+#include "ioprocsvec.h"
+#include "osdcore.h"
+
+#include <cstdint>
+#include <vector>
+
+
+namespace {
+
+//-------------------------------------------------
+//  make_test_bitmap - gradients with some noise,
+//  so that every prediction filter gets chosen
+//-------------------------------------------------
+
+bitmap_argb32 make_test_bitmap(int width, int height)
+{
+	// fixed LCG so every run encodes the same image
+	std::uint32_t seed = 12345;
+	bitmap_argb32 bitmap(width, height);
+	for (int y = 0; y < height; y++)
+		for (int x = 0; x < width; x++)
+		{
+			seed = seed * 1664525U + 1013904223U;
+			std::uint8_t const noise = ((x / 8) & 1) ? std::uint8_t(seed >> 24) : 0;
+			bitmap.pix(y, x) = rgb_t(0xff - (y & 0x7f), x & 0xff, y & 0xff, (x + y + noise) & 0xff);
+		}
+	return bitmap;
+}
+
+
+//-------------------------------------------------
+//  round_trip - write a bitmap with the given
+//  options and read it back
+//-------------------------------------------------
+
+void round_trip(bitmap_argb32 const &source, util::png_write_options const &options)
+{
+	std::vector<std::uint8_t> storage;
+	{
+		util::vector_read_write_adapter<std::uint8_t> writer(storage);
+		REQUIRE(!util::png_write_bitmap(writer, nullptr, source, 0, nullptr, options));
+	}
+
+	bitmap_argb32 result;
+	util::random_read::ptr reader = util::ram_read(storage.data(), storage.size());
+	REQUIRE(reader);
+	REQUIRE(!util::png_read_bitmap(*reader, result));
+	REQUIRE(result.width() == source.width());
+	REQUIRE(result.height() == source.height());
+	for (int y = 0; y < source.height(); y++)
+		for (int x = 0; x < source.width(); x++)
+			REQUIRE(result.pix(y, x) == source.pix(y, x));
+}
+
+} // anonymous namespace
+
+
+TEST_CASE("PNG round trip unfiltered", "[util]")
+{
+	util::png_write_options options;
+	options.adaptive_filter = false;
+	round_trip(make_test_bitmap(67, 31), options);
+}
+
+TEST_CASE("PNG round trip with adaptive filters", "[util]")
+{
+	util::png_write_options options;
+	round_trip(make_test_bitmap(67, 31), options);
+}
+
+TEST_CASE("PNG round trip at the fast level", "[util]")
+{
+	util::png_write_options options;
+	options.level = 1;
+	round_trip(make_test_bitmap(67, 31), options);
+}
+
+TEST_CASE("PNG round trip with parallel deflate", "[util]")
+{
+	// big enough to be split into several segments
+	osd_work_queue *const queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	util::png_write_options options;
+	options.queue = queue;
+	round_trip(make_test_bitmap(333, 417), options);
+	options.level = 1;
+	round_trip(make_test_bitmap(333, 417), options);
+	osd_work_queue_free(queue);
+}